@@ -6,90 +6,185 @@
 * 8 Slider Puzzle Program
 * This program searches for and records solutions to the 8 slider puzzle. The puzzle may be
 * generated randomly or provided by the user. It can search for a solution using breadth first
-* searching, depth first searcing, or A* (number of misplaced tiles or Manhattan distance) searching.
-* The results of the search will be displayed to the user.
+* searching (one way or from both ends), depth first searcing (depth limited or iterative
+* deepening), A* (number of misplaced tiles, Manhattan distance, Manhattan distance plus linear
+* conflicts or a pattern database) searching, IDA*, parallel or anytime weighted A* searching, or
+* look it up in a table of exact distances.
+* The results of the search will be displayed to the user. Files of start states can also be
+* solved in batch mode from the command line, without the menu. The searches themselves are
+* run through the Solver class in Solver.h.
 **************************************************************************************************/
 
+#include "Solver.h"
+#include "SlidingPuzzle.h"
+
 #include<iostream>
 #include<string>
 #include<algorithm>
-#include<list>
-#include<map>
-#include<stack>
-#include<queue>
+#include<vector>
+#include<limits>
+#include<cstdlib>
+#include<fstream>
+#include<random>
+#include<atomic>
+#include<thread>
+#include<memory>
 
 using namespace std;
 
-// Node used during solution searches
-struct node
-{
-	// String used to represent the environment state
-	string stateString;
-
-	// Array used to hold the values of the environment state
-	int stateArray[9];
-
-	// Int used to hold the value representing the depth of the search tree
-	int depth = 0;
-
-	// List of all the states in the solution path
-	list <string> path;
-
-	// Heuristic used for the A* searches
-	int heuristic = 0;
-
-	// Operator used to give states with fewer misplaced tiles priority when
-	// being inserted into the priority queue
-	bool operator < (const node& other) const
-	{
-		return heuristic > other.heuristic;
-	}
-
-};
-
-// A string representing what the goal state looks like
-string goalState = "123456780";
-
-// An array representing what the goal state looks like
-int goalStateArray[] = { 1, 2, 3, 4, 5, 6, 7, 8, 0 };
+// Descriptions and short names of the heuristics, indexed by the search number
+const string heuristicDescriptions[] = { "", "", "", "the number of misplaced tiles",
+	"the Manhattan distance", "the Manhattan distance plus linear conflicts",
+	"a pattern database" };
+const string heuristicNames[] = { "", "", "", "misplaced tiles", "Manhattan distance",
+	"linear conflicts", "pattern database" };
 
 // Array representing the initial state of the environment
 int initialState[9];
 
-// Array used to work with so as not to lose the initial state
-int workingState[9];
+// Random number generator used to shuffle random initial states
+mt19937 randomGenerator(random_device{}());
 
-// Map used to keep track of seen states
-map<string, int> seenStates;
+// Solver used by the searches started from the menu, allowed to use every core
+Solver menuSolver(max(1u, thread::hardware_concurrency()));
 
-// Queue used for breadth first search and stack used for depth first search
-// Priority queue used for A* search using misplaced tiles
-queue <node> nodeQueue;
-stack <node> nodeStack;
-priority_queue <node> priorityQueue;
+// Number of start states batch mode reads and solves at a time. Results are written in
+// input order once each chunk is solved, so memory stays bounded on very long files
+const size_t batchChunk = 4096;
+
+// Menu choice of the anytime search, the first one batch mode can't run
+const int anytimeChoice = 14;
+
+// Menu choice used to exit the program
+const int exitChoice = 15;
 
 // Function prototypes
 int userMenu();
+int batchSolve(const string& inputName, const string& outputName, int choice, int size, int threadCount);
+void batchWorker(Solver& solver, const vector<string>& lines, const vector<size_t>& order,
+	vector<string>& records, atomic<size_t>& nextLine, int choice, int size);
+void batchOrder(const vector<string>& lines, int size, vector<size_t>& order);
+string batchRecord(Solver& solver, const string& line, int choice);
+string puzzleRecord(const string& line, int size);
+bool parseBoard(const string& line, board& state);
+bool parsePuzzle(const string& line, int cellCount, vector<int>& tiles);
 int generateInitialState();
 int inputInitialState();
+bool checkSolvable(board state);
 int breadthFirstSearch();
+int bidirectionalSearch();
 int depthFirstSearch();
+int iterativeDeepeningSearch();
 int misplacedTilesSearch();
 int manhattanDistanceSearch();
-void generateSuccessors(node state, int num);
-bool checkSeenStates(string state);
-
-int main()
+int linearConflictSearch();
+int patternDatabaseSearch();
+int distanceOracleSearch();
+int aStarSearch(int num);
+int idaStarSearch();
+int hdaStarSearch();
+int anytimeSearch();
+int displayResult(const searchResult& result, const string& method, const string& countName);
+
+int main(int argc, char* argv[])
 {
+	// Options read from the command line for batch mode
+	string inputName;
+	string outputName;
+	string cacheName;
+	int batchChoice = 0;
+	int batchSize = 3;
+	int threadCount = (int)max(1u, thread::hardware_concurrency());
+
+	// Reads each option and the value that follows it
+	for (int i = 1; i < argc; i++)
+	{
+		string option = argv[i];
+		if (i + 1 < argc && option == "--batch")
+		{
+			inputName = argv[++i];
+		}
+		else if (i + 1 < argc && option == "--output")
+		{
+			outputName = argv[++i];
+		}
+		else if (i + 1 < argc && option == "--choice")
+		{
+			batchChoice = atoi(argv[++i]);
+		}
+		else if (i + 1 < argc && option == "--threads")
+		{
+			threadCount = atoi(argv[++i]);
+		}
+		else if (i + 1 < argc && option == "--cache")
+		{
+			cacheName = argv[++i];
+		}
+		else if (i + 1 < argc && option == "--size")
+		{
+			batchSize = atoi(argv[++i]);
+		}
+		else
+		{
+			inputName.clear();
+			break;
+		}
+	}
+
+	// Solves a file of start states without the menu when any option is given
+	if (argc > 1)
+	{
+		if (inputName.empty() || batchChoice < 3 || batchChoice >= anytimeChoice || threadCount < 1
+			|| batchSize < 3 || batchSize > 5)
+		{
+			cerr << "Usage: " << argv[0] << " --batch <input file> --choice <3-" << anytimeChoice - 1
+				<< "> [--threads <count>] [--output <output file>] [--cache <cache file>]"
+				<< " [--size <3-5>]" << endl;
+			return 1;
+		}
+
+		// Only IDA* keeps no table of states, so it is the only search that can take on the
+		// 15 and 24 puzzles
+		if (batchSize != 3 && batchChoice != 10)
+		{
+			cerr << "Puzzles larger than 3x3 can only be solved with choice 10" << endl;
+			return 1;
+		}
+
+		// Starts from the solutions saved by earlier runs, if there are any, and saves them
+		// again with this run's added once every state is solved
+		if (cacheName.empty() == false)
+		{
+			Solver::loadCache(cacheName);
+		}
+
+		Solver::loadTables();
+		int status = batchSolve(inputName, outputName, batchChoice, batchSize, threadCount);
+		Solver::releaseTables();
+
+		if (cacheName.empty() == false && Solver::saveCache(cacheName) == false)
+		{
+			cerr << "Could not write " << cacheName << endl;
+		}
+		return status;
+	}
+
 	// Displays message describing program to the user
 	cout << "Welcome to the 8 slider puzzle solution finder." << endl;
 	cout << "This program will search for a solution path and display the result." << endl << endl;
 
+	// Maps the pattern database into memory, building it on the first run
+	if (Solver::tablesSaved() == false)
+	{
+		cout << "Building the pattern database..." << endl;
+	}
+	Solver::loadTables();
+
 	// Int used to represent the user's menu choice
 	int userMenuChoice = 0;
 
-	// Loops until the user enters 7 to exit the program
-	while (userMenuChoice != 7)
+	// Loops until the user enters the exit choice to exit the program
+	while (userMenuChoice != exitChoice)
 	{
 		// Displays the menu and gets the user's choice
 		userMenuChoice = userMenu();
@@ -118,7 +213,7 @@ int main()
 		case 4:
 			// Clears the screen for formatting
 			system("cls");
-			// Performs a depth first search and displays the result
+			// Performs a depth limited depth first search and displays the result
 			depthFirstSearch();
 			break;
 		case 5:
@@ -130,11 +225,60 @@ int main()
 		case 6:
 			// Clears the screen for formatting
 			system("cls");
-			// Performs an A* search using misplaced tiles and displays the result
+			// Performs an A* search using Manhattan distance and displays the result
 			manhattanDistanceSearch();
 			break;
 		case 7:
-			// Exits the program
+			// Clears the screen for formatting
+			system("cls");
+			// Performs an A* search using linear conflicts and displays the result
+			linearConflictSearch();
+			break;
+		case 8:
+			// Clears the screen for formatting
+			system("cls");
+			// Performs an A* search using the pattern database and displays the result
+			patternDatabaseSearch();
+			break;
+		case 9:
+			// Clears the screen for formatting
+			system("cls");
+			// Walks the distance oracle to the goal and displays the result
+			distanceOracleSearch();
+			break;
+		case 10:
+			// Clears the screen for formatting
+			system("cls");
+			// Performs an IDA* search using the pattern database and displays the result
+			idaStarSearch();
+			break;
+		case 11:
+			// Clears the screen for formatting
+			system("cls");
+			// Performs a bidirectional breadth first search and displays the result
+			bidirectionalSearch();
+			break;
+		case 12:
+			// Clears the screen for formatting
+			system("cls");
+			// Performs a parallel A* search using the pattern database and displays the result
+			hdaStarSearch();
+			break;
+		case 13:
+			// Clears the screen for formatting
+			system("cls");
+			// Performs an iterative deepening depth first search and displays the result
+			iterativeDeepeningSearch();
+			break;
+		case anytimeChoice:
+			// Clears the screen for formatting
+			system("cls");
+			// Performs an anytime weighted A* search using Manhattan distance and displays the result
+			anytimeSearch();
+			break;
+		case exitChoice:
+			// Releases the pattern database and exits the program
+			Solver::releaseTables();
 			return 0;
 		}
 	}
@@ -153,14 +297,22 @@ int userMenu()
 	system("cls");
 
 	// Displays the menu to the user
-	cout << "Please choose an option. Enter 7 to exit the program." << endl
+	cout << "Please choose an option. Enter " << exitChoice << " to exit the program." << endl
 		<< "1: Create a random initial state." << endl
 		<< "2: Manualy enter the initial state." << endl
 		<< "3: Perform breadth first search." << endl
-		<< "4: Perform depth first search." << endl
+		<< "4: Perform depth limited depth first search." << endl
 		<< "5: Perform A* search using misplaced tiles." << endl
 		<< "6: Perform A* search using Manhattan distance." << endl
-		<< "7: Exit the program." << endl
+		<< "7: Perform A* search using linear conflicts." << endl
+		<< "8: Perform A* search using a pattern database." << endl
+		<< "9: Solve using the exact distance oracle." << endl
+		<< "10: Perform IDA* search using a pattern database." << endl
+		<< "11: Perform bidirectional breadth first search." << endl
+		<< "12: Perform parallel A* search using a pattern database." << endl
+		<< "13: Perform iterative deepening depth first search." << endl
+		<< "14: Perform anytime weighted A* search using Manhattan distance." << endl
+		<< exitChoice << ": Exit the program." << endl
 		<< "Current initial state: ";
 
 	for (int i = 0; i < 9; i++)
@@ -176,8 +328,14 @@ int userMenu()
 	cout << endl;
 
 	// Checks to see if the choice was valid
-	while ( (cin.fail()) || (choice < 1) || (choice > 7) )
+	while ( (cin.fail()) || (choice < 1) || (choice > exitChoice) )
 	{
+		// Exits once the input has run out, since no valid choice can follow
+		if (cin.eof())
+		{
+			return exitChoice;
+		}
+
 		// Clears the cin and buffer
 		cin.clear();
 		cin.ignore(numeric_limits<streamsize>::max(), '\n');
@@ -192,6 +350,219 @@ int userMenu()
 	return choice;
 }
 
+int batchSolve(const string& inputName, const string& outputName, int choice, int size, int threadCount)
+{
+	// Opens the file of start states
+	ifstream input(inputName);
+	if (!input)
+	{
+		cerr << "Could not open " << inputName << endl;
+		return 1;
+	}
+
+	// Opens the output file, or writes to the console when none was given
+	ofstream outputFile;
+	if (outputName.empty() == false)
+	{
+		outputFile.open(outputName);
+		if (!outputFile)
+		{
+			cerr << "Could not open " << outputName << endl;
+			return 1;
+		}
+	}
+	ostream& output = outputName.empty() ? cout : outputFile;
+
+	// One single threaded solver per thread, kept for the whole run so their memory is reused
+	vector <Solver> solvers;
+	for (int t = 0; t < threadCount; t++)
+	{
+		solvers.emplace_back(1);
+	}
+
+	// Lines of the current chunk, the order they are solved in and the record written for each one
+	vector <string> lines;
+	vector <size_t> order;
+	vector <string> records;
+	string line;
+
+	// Reads, solves and writes one chunk of lines at a time until the input runs out
+	while (getline(input, line))
+	{
+		lines.clear();
+		lines.push_back(line);
+		while (lines.size() < batchChunk && getline(input, line))
+		{
+			lines.push_back(line);
+		}
+		records.assign(lines.size(), string());
+		batchOrder(lines, size, order);
+
+		// Each thread takes the next unsolved line until none are left
+		atomic <size_t> nextLine(0);
+		vector <thread> workers;
+		for (int t = 1; t < threadCount; t++)
+		{
+			workers.emplace_back(batchWorker, ref(solvers[t]), cref(lines), cref(order), ref(records),
+				ref(nextLine), choice, size);
+		}
+		batchWorker(solvers[0], lines, order, records, nextLine, choice, size);
+		for (size_t t = 0; t < workers.size(); t++)
+		{
+			workers[t].join();
+		}
+
+		// Writes the records in the same order as the lines they came from
+		for (size_t i = 0; i < records.size(); i++)
+		{
+			output << records[i] << '\n';
+		}
+	}
+
+	output.flush();
+	return 0;
+}
+
+void batchWorker(Solver& solver, const vector<string>& lines, const vector<size_t>& order,
+	vector<string>& records, atomic<size_t>& nextLine, int choice, int size)
+{
+	// Claims lines one at a time so a slow board doesn't hold up a whole share of them
+	for (size_t next = nextLine.fetch_add(1); next < order.size(); next = nextLine.fetch_add(1))
+	{
+		size_t i = order[next];
+		records[i] = size == 3 ? batchRecord(solver, lines[i], choice) : puzzleRecord(lines[i], size);
+	}
+}
+
+void batchOrder(const vector<string>& lines, int size, vector<size_t>& order)
+{
+	// Starts from the order of the lines
+	order.resize(lines.size());
+	for (size_t i = 0; i < order.size(); i++)
+	{
+		order[i] = i;
+	}
+
+	// Only 8 puzzle boards can be scored
+	if (size != 3)
+	{
+		return;
+	}
+
+	// Scores every board of the chunk at once by its Manhattan distance, leaving lines that
+	// aren't a board as an empty board, which scores zero
+	vector <board> states(lines.size(), 0);
+	vector <int> distances(lines.size());
+	for (size_t i = 0; i < lines.size(); i++)
+	{
+		parseBoard(lines[i], states[i]);
+	}
+	manhattanDistances(states.data(), states.size(), distances.data());
+
+	// Solves the boards furthest from the goal first, since they tend to take the longest, so
+	// the threads finish the chunk together instead of one being left with a hard board
+	stable_sort(order.begin(), order.end(), [&distances](size_t a, size_t b)
+	{
+		return distances[a] > distances[b];
+	});
+}
+
+string batchRecord(Solver& solver, const string& line, int choice)
+{
+	// Reads the start state, reporting lines that aren't one
+	board start = 0;
+	if (parseBoard(line, start) == false)
+	{
+		return line + " invalid";
+	}
+
+	// Names the start state the same way however it was written
+	string name = boardToString(start);
+
+	// Solves the state with the search of the same menu choice
+	searchResult result = solver.solve(start, (searchAlgorithm)choice);
+
+	// Reports start states that can never reach the goal
+	if (result.solvable == false)
+	{
+		return name + " unsolvable";
+	}
+
+	// Records the outcome, the depth, the nodes expanded, the time taken in microseconds and
+	// the moves of the blank, written as a dash when there are none
+	string moves = pathMoves(result.path);
+
+	return name + (result.solved ? " solved " : " failed ") + to_string(result.depth) + " "
+		+ to_string(result.nodesExpanded) + " " + to_string((long long)(result.milliseconds * 1000))
+		+ " " + (moves.empty() ? "-" : moves);
+}
+
+string puzzleRecord(const string& line, int size)
+{
+	// Reads the start state, reporting lines that aren't one
+	vector <int> tiles;
+	if (parsePuzzle(line, size * size, tiles) == false)
+	{
+		return line + " invalid";
+	}
+
+	// Names the start state by its tiles separated by commas, since they can take two digits
+	string name;
+	for (size_t i = 0; i < tiles.size(); i++)
+	{
+		name += (i == 0 ? "" : ",") + to_string(tiles[i]);
+	}
+
+	// Solves the state with the IDA* search built for its size
+	puzzleResult result = size == 4 ? solvePuzzle<4, 4>(tiles) : solvePuzzle<5, 5>(tiles);
+
+	// Reports start states that can never reach the goal
+	if (result.solvable == false)
+	{
+		return name + " unsolvable";
+	}
+
+	// Records the outcome the same way as for the 8 puzzle
+	return name + " solved " + to_string(result.depth) + " " + to_string(result.nodesExpanded) + " "
+		+ to_string((long long)(result.milliseconds * 1000)) + " " + (result.moves.empty() ? "-" : result.moves);
+}
+
+bool parseBoard(const string& line, board& state)
+{
+	// Tiles read from the line and which of them have been seen
+	int tiles[9];
+	bool seen[9] = {};
+	int count = 0;
+
+	// Reads each digit, skipping spaces and the carriage return of Windows line endings
+	for (size_t i = 0; i < line.size(); i++)
+	{
+		char c = line[i];
+		if (c == ' ' || c == '\t' || c == '\r')
+		{
+			continue;
+		}
+
+		// Rejects anything other than nine different digits from 0 to 8
+		if (c < '0' || c > '8' || count == 9 || seen[c - '0'])
+		{
+			return false;
+		}
+
+		seen[c - '0'] = true;
+		tiles[count] = c - '0';
+		count += 1;
+	}
+
+	if (count != 9)
+	{
+		return false;
+	}
+
+	state = packBoard(tiles);
+	return true;
+}
+
 int generateInitialState()
 {
 	// Message to let the user know what is going to happen
@@ -204,7 +575,16 @@ int generateInitialState()
 	}
 
 	// Shuffles the values in the array to create a random initial state
-	random_shuffle(initialState, initialState + 9);
+	shuffle(initialState, initialState + 9, randomGenerator);
+
+	// Half of all shuffles can't be solved. Swapping two numbered tiles flips that, so
+	// the first two tiles that aren't the blank are swapped when the shuffle is unsolvable
+	if (!isSolvable(packBoard(initialState)))
+	{
+		int first = (initialState[0] == 0) ? 1 : 0;
+		int second = (initialState[first + 1] == 0) ? first + 2 : first + 1;
+		swap(initialState[first], initialState[second]);
+	}
 
 	// Displays the initial state that was generated
 	cout << "Initial state: ";
@@ -248,6 +628,13 @@ int inputInitialState()
 		while ( ((cin.fail()) || (tempNum < 0) || (tempNum > 8)) || 
 			(find(initialState, initialState + 9, tempNum) != initialState + 9) )
 		{
+			// Exits once the input has run out, since no valid number can follow
+			if (cin.eof())
+			{
+				Solver::releaseTables();
+				exit(0);
+			}
+
 			// Clears the cin and buffer
 			cin.clear();
 			cin.ignore(numeric_limits<streamsize>::max(), '\n');
@@ -272,2770 +659,328 @@ int inputInitialState()
 	// Formatting
 	cout << endl << endl;
 
+	// Warns the user straight away if the state can't be solved
+	if (!isSolvable(packBoard(initialState)))
+	{
+		cout << "This state has no solution, so every search will report that without searching." << endl << endl;
+	}
+
 	system("pause");
 	return 0;
 }
 
+bool checkSolvable(board state)
+{
+	// Lets the search go ahead if the state can be solved
+	if (isSolvable(state))
+	{
+		return true;
+	}
+
+	// Otherwise reports straight away instead of searching every reachable state
+	cout << "No solution was found. The initial state has an odd number of inversions"
+		<< endl << "and can never reach the goal state." << endl;
+	system("pause");
+	return false;
+}
+
 int breadthFirstSearch()
 {
 	// Message to let the user know what is going to happen
 	cout << "A breadth first search will be performed and the result displayed." << endl << endl;
 
-	// Creates a string to represent the state
-	string stateStr;
-	for (int i = 0; i < 9; i++)
+	// Packs the initial state into a board
+	board stateBoard = packBoard(initialState);
+
+	// Checks the state can be solved before searching
+	if (checkSolvable(stateBoard) == false)
 	{
-		stateStr += to_string(initialState[i]);
+		return 1;
 	}
-	
-	// Counter used to keep track of the depth
-	int depthCounter = 0;
 
-	// Var used to keep track of how many nodes are expanded
-	int nodesExpanded = 0;
+	// Performs the search and displays the result
+	return displayResult(menuSolver.solve(stateBoard, searchAlgorithm::breadthFirst),
+		"breadth first searching", "Nodes expanded");
+}
 
-	// Creates a node to store the first state
-	node state;
+int bidirectionalSearch()
+{
+	// Message to let the user know what is going to happen
+	cout << "A bidirectional breadth first search will be performed and the result displayed." << endl << endl;
 
-	// Fills in the data for the node
-	state.stateString = stateStr;
-	for (int i = 0; i < 9; i++)
+	// Packs the initial state into a board
+	board stateBoard = packBoard(initialState);
+
+	// Checks the state can be solved before searching
+	if (checkSolvable(stateBoard) == false)
 	{
-		state.stateArray[i] = initialState[i];
+		return 1;
 	}
-	state.depth = depthCounter;
-	state.path.push_back(state.stateString);
 
-	// Puts the node in the queue
-	nodeQueue.push(state);
+	// Performs the search and displays the result
+	return displayResult(menuSolver.solve(stateBoard, searchAlgorithm::bidirectional),
+		"bidirectional breadth first searching", "Nodes expanded");
+}
+
+int depthFirstSearch()
+{
+	// Settings of the search, limiting it to the most moves any state needs
+	searchOptions options;
 
-	// Puts the current state and depth counter in the map
-	seenStates[stateStr] = depthCounter;
+	// Message to let the user know what is going to happen
+	cout << "A depth first search limited to " << options.depthLimit
+		<< " moves will be performed and the result displayed." << endl << endl;
 
-	// Sentinel value for while loop exit condition
-	bool goalStateReached = false;
+	// Packs the initial state into a board
+	board stateBoard = packBoard(initialState);
 
-	// Loops search until the goal state is found
-	while (goalStateReached == false)
+	// Checks the state can be solved before searching
+	if (checkSolvable(stateBoard) == false)
 	{
-		// Checks to see if the the queue is empty
-		if (nodeQueue.empty())
-		{
-			//If so, then no solution was found since the loop didn't exit via sentinel value
-			cout << endl << "No solution was found using breadth first searching."
-				<< endl << "Depth reached was: " << depthCounter
-				<< endl << "Nodes expanded: " << nodesExpanded << endl;
-			system("pause");
-			return 1;
-		}
+		return 1;
+	}
 
-		// Checks to see if the next node in the queue has the goal state
-		if (nodeQueue.front().stateString == goalState)
-		{
-			// Sets sentinel value to true
-			goalStateReached = true;
+	// Performs the search and displays the result
+	return displayResult(menuSolver.solve(stateBoard, searchAlgorithm::depthFirst, options),
+		"depth limited depth first searching", "Nodes expanded");
+}
 
-		}
-		// If the next node in the queue isn't the goal state
-		else
-		{
-			// Variable to let generateSuccessor function know to use the queue
-			int breadth = 1;
+int iterativeDeepeningSearch()
+{
+	// Message to let the user know what is going to happen
+	cout << "An iterative deepening depth first search will be performed and the result displayed." << endl << endl;
 
-			// Passes that state to a function to generate successor states
-			generateSuccessors(nodeQueue.front(), breadth);
+	// Packs the initial state into a board
+	board stateBoard = packBoard(initialState);
 
-			// Records that a node was expanded
-			nodesExpanded += 1;
+	// Checks the state can be solved before searching
+	if (checkSolvable(stateBoard) == false)
+	{
+		return 1;
+	}
 
-			// Records the depth reached in case a solution isn't found
-			depthCounter = nodeQueue.front().depth;
+	// Performs the search and displays the result
+	return displayResult(menuSolver.solve(stateBoard, searchAlgorithm::iterativeDeepening),
+		"iterative deepening depth first searching", "Nodes expanded");
+}
 
-			// Pops the looked at state off the queue
-			nodeQueue.pop();
-		}
-	}
+int misplacedTilesSearch()
+{
+	// Variable to let the A* search know to use the number of misplaced tiles
+	int misplacedTilesSearch = 3;
 
-	// Displays how many nodes were expanded
-	cout << "Nodes expanded: " << nodesExpanded << endl;
+	return aStarSearch(misplacedTilesSearch);
+}
 
-	// Displays the depth of the solution
-	cout << "Depth of solution path: " << nodeQueue.front().depth << endl;
+int manhattanDistanceSearch()
+{
+	// Variable to let the A* search know to use the Manhattan distance
+	int manhattanDistanceSearch = 4;
 
-	// Displays the path that was recorded
-	cout << "Breadth first solution path: " << endl;
-	// While the list still contains locations
-	while (!nodeQueue.front().path.empty())
-	{
-		//Displays the location in the front of the list
-		cout << nodeQueue.front().path.front();
-		// Removes the location in the front of the list
-		nodeQueue.front().path.pop_front();
+	return aStarSearch(manhattanDistanceSearch);
+}
 
-		cout << endl;
-	}
+int linearConflictSearch()
+{
+	// Variable to let the A* search know to use the Manhattan distance plus linear conflicts
+	int linearConflictSearch = 5;
 
-	// Empties the queue so it can be used again
-	while (!nodeQueue.empty())
-	{
-		nodeQueue.pop();
-	}
+	return aStarSearch(linearConflictSearch);
+}
 
-	// Empties the map
-	seenStates.clear();
+int patternDatabaseSearch()
+{
+	// Variable to let the A* search know to use the pattern database
+	int patternDatabaseSearch = 6;
 
-	system("pause");
-	return 0;
+	return aStarSearch(patternDatabaseSearch);
 }
 
-int depthFirstSearch()
+int idaStarSearch()
 {
+	// Variable naming the pattern database, the heuristic the IDA* search uses
+	int num = 6;
+
 	// Message to let the user know what is going to happen
-	cout << "A depth first search will be performed and the result displayed." << endl << endl;
+	cout << "An IDA* search using " << heuristicDescriptions[num]
+		<< " will be performed and the result displayed." << endl << endl;
 
-	// Creates a string to represent the state
-	string stateStr;
-	for (int i = 0; i < 9; i++)
+	// Packs the initial state into a board
+	board stateBoard = packBoard(initialState);
+
+	// Checks the state can be solved before searching
+	if (checkSolvable(stateBoard) == false)
 	{
-		stateStr += to_string(initialState[i]);
+		return 1;
 	}
 
-	// Var to keep track of how many nodes are expanded
-	int nodesExpanded = 0;
+	// Performs the search and displays the result
+	return displayResult(menuSolver.solve(stateBoard, searchAlgorithm::idaStar),
+		"IDA*(" + heuristicNames[num] + ") searching", "Nodes expanded");
+}
+
+int hdaStarSearch()
+{
+	// Variable naming the pattern database, the heuristic the parallel A* search uses
+	int num = 6;
 
-	// Counter used to keep track of the depth
-	int depthCounter = 0;
+	// Message to let the user know what is going to happen
+	cout << "A parallel A* search using " << heuristicDescriptions[num]
+		<< " will be performed and the result displayed." << endl << endl;
 
-	// Creates a node to store the first state
-	node state;
+	// Packs the initial state into a board
+	board stateBoard = packBoard(initialState);
 
-	// Fills in the data for the node
-	state.stateString = stateStr;
-	for (int i = 0; i < 9; i++)
+	// Checks the state can be solved before searching
+	if (checkSolvable(stateBoard) == false)
 	{
-		state.stateArray[i] = initialState[i];
+		return 1;
 	}
-	state.depth = depthCounter;
 
-	// Puts the node in the stack
-	nodeStack.push(state);
+	// Performs the search and displays the result
+	return displayResult(menuSolver.solve(stateBoard, searchAlgorithm::parallelAStar),
+		"parallel A*(" + heuristicNames[num] + ") searching", "Nodes expanded");
+}
 
-	// Puts the current state and depth counter in the map
-	seenStates[stateStr] = depthCounter;
+int distanceOracleSearch()
+{
+	// Message to let the user know what is going to happen
+	cout << "A walk down the exact distance oracle will be performed and the result displayed." << endl << endl;
 
-	// Sentinel value for while loop exit condition
-	bool goalStateReached = false;
+	// Packs the initial state into a board
+	board stateBoard = packBoard(initialState);
 
-	// Loops search until the solution state is found
-	while (goalStateReached == false)
+	// Checks the state can be solved, since the oracle only holds solvable states
+	if (checkSolvable(stateBoard) == false)
 	{
-		// Checks to see if the the stack is empty
-		if (nodeStack.empty())
-		{
-			//If so, then no solution was found since the loop didn't exit via sentinel value
-			cout << endl << "No solution was found using depth first searching."
-				<< endl << "Depth reached was: " << depthCounter
-				<< endl << "Nodes expanded: " << endl;
-			system("pause");
-			return 1;
-		}
-
-		// Checks to see if the next node in the stack has the goal state
-		if (nodeStack.top().stateString == goalState)
-		{
-			// Sets sentinel value to true
-			goalStateReached = true;
-		}
-		// If the next node in the stack isn't the goal state
-		else
-		{
-			// Variable to let generateSuccessor function know to use the stack
-			int depthSearch = 2;
+		return 1;
+	}
 
-			// Temp node to hold the state's data
-			node tempState;
+	// Performs the walk and displays the result
+	return displayResult(menuSolver.solve(stateBoard, searchAlgorithm::distanceOracle),
+		"the distance oracle", "Table lookups");
+}
 
-			// Copy the state's data to tempState
-			tempState.stateString = nodeStack.top().stateString;
-			for (int i = 0; i < 9; i++)
-			{
-				tempState.stateArray[i] = nodeStack.top().stateArray[i];
-			}
-			tempState.depth = nodeStack.top().depth;
-
-			// Records the depth reached in case a solutin isn't found
-			depthCounter = nodeStack.top().depth;
-
-			// Pops the looked at state off the stack
-			nodeStack.pop();
-
-			// Passes that state to a function to generate successor states
-			generateSuccessors(tempState, depthSearch);
-
-			// Records that a node was expanded
-			nodesExpanded += 1;
-		}
-	}
-
-	// Displays how many nodes were expanded
-	cout << "Nodes expanded: " << nodesExpanded << endl;
-
-	// Displays the depth of the solution
-	cout << "Depth of solution path: " << nodeStack.top().depth << endl;
-
-	// Empties the stack so it can be used again
-	while (!nodeStack.empty())
-	{
-		nodeStack.pop();
-	}
-
-	// Empties the map
-	seenStates.clear();
-
-	system("pause");
-	return 0;
-}
-
-int misplacedTilesSearch()
+int aStarSearch(int num)
 {
 	// Message to let the user know what is going to happen
-	cout << "An A* search using the number of misplaced tiles will be performed and the result displayed." << endl << endl;
-
-	// Creates a string to represent the state
-	string stateStr;
-	for (int i = 0; i < 9; i++)
-	{
-		stateStr += to_string(initialState[i]);
-	}
-
-	// Counter used to keep track of the depth
-	int depthCounter = 0;
-
-	// Var to keep track of how many nodes are expanded
-	int nodesExpanded = 0;
-
-	// Creates a node to store the first state
-	node state;
-
-	// Fills in the data for the node
-	state.stateString = stateStr;
-	for (int i = 0; i < 9; i++)
-	{
-		state.stateArray[i] = initialState[i];
-	}
-	state.depth = depthCounter;
-	// Calculates the number of misplaced tiles
-	for (int i = 0; i < 9; i++)
-	{
-		if (state.stateArray[i] != goalStateArray[i] && state.stateArray[i] != 0)
-		{
-			state.heuristic += 1;
-		}
-	}
-	state.heuristic += state.depth;
-	state.path.push_back(state.stateString);
+	cout << "An A* search using " << heuristicDescriptions[num]
+		<< " will be performed and the result displayed." << endl << endl;
 
-	// Puts the node in the priority queue
-	priorityQueue.push(state);
+	// Packs the initial state into a board
+	board stateBoard = packBoard(initialState);
 
-	// Puts the current state and depth counter in the map
-	seenStates[stateStr] = depthCounter;
-
-	// Sentinel value for while loop exit condition
-	bool goalStateReached = false;
-
-	// Loops search until the goal state is found
-	while (goalStateReached == false)
+	// Checks the state can be solved before searching
+	if (checkSolvable(stateBoard) == false)
 	{
-		// Checks to see if the the priority queue is empty
-		if (priorityQueue.empty())
-		{
-			//If so, then no solution was found since the loop didn't exit via sentinel value
-			cout << endl << "No solution was found using A*(misplaced tiles) searching."
-				<< endl << "Depth reached was: " << depthCounter
-				<< endl << "Nodes expanded: " << nodesExpanded << endl;
-			system("pause");
-			return 1;
-		}
-
-		// Checks to see if the next node in the priority queue has the goal state
-		if (priorityQueue.top().stateString == goalState)
-		{
-			// Sets sentinel value to true
-			goalStateReached = true;
-
-		}
-		// If the next node in the priority queue isn't the goal state
-		else
-		{
-			// Variable to let generateSuccessor function know to use the priority queue
-			int misplacedTilesSearch = 3;
-
-			// Temp node to hold the state's data
-			node tempState;
-
-			// Copy the state's data to tempState
-			tempState.stateString = priorityQueue.top().stateString;
-			for (int i = 0; i < 9; i++)
-			{
-				tempState.stateArray[i] = priorityQueue.top().stateArray[i];
-			}
-			tempState.heuristic = priorityQueue.top().heuristic;
-			tempState.depth = priorityQueue.top().depth;
-			tempState.path = priorityQueue.top().path;
-
-			// Records the depth reached in case a solution isn't found
-			depthCounter = priorityQueue.top().depth;
-
-			// Pops the looked at state off the priority queue
-			priorityQueue.pop();
-
-			// Passes that state to a function to generate successor states
-			generateSuccessors(tempState, misplacedTilesSearch);
-
-			// Records that a node was expanded
-			nodesExpanded += 1;
-		}
+		return 1;
 	}
 
-	// Displays how many nodes were expanded
-	cout << "Nodes expanded: " << nodesExpanded << endl;
+	// Performs the search and displays the result. The menu choices of the A* searches are
+	// numbered two after the heuristics they use
+	return displayResult(menuSolver.solve(stateBoard, (searchAlgorithm)(num + 2)),
+		"A*(" + heuristicNames[num] + ") searching", "Nodes expanded");
+}
 
-	// Displays the depth of the solution
-	cout << "Depth of solution path: " << priorityQueue.top().depth << endl;
+int anytimeSearch()
+{
+	// Settings of the search, starting at three times the heuristic and lowering the weight
+	// by a half each time a path is found until the path is known to be the shortest
+	searchOptions options;
+	options.weight = 3;
+	options.anytime = true;
 
-	// Creates an iterator to move through the list
-	list<string>::const_iterator it;
-	it = priorityQueue.top().path.begin();
+	// Message to let the user know what is going to happen
+	cout << "An anytime A* search using " << heuristicDescriptions[4] << " weighted by "
+		<< options.weight << " will be performed and the result displayed." << endl << endl;
 
-	// Moves through the list, displaying the solution path
-	for (it; it != priorityQueue.top().path.end(); ++it)
-	{
-		cout << *it << endl;
-	}
+	// Packs the initial state into a board
+	board stateBoard = packBoard(initialState);
 
-	// Empties the priority queue so it can be used again
-	while (!priorityQueue.empty())
+	// Checks the state can be solved before searching
+	if (checkSolvable(stateBoard) == false)
 	{
-		priorityQueue.pop();
+		return 1;
 	}
 
-	// Empties the map
-	seenStates.clear();
-
-	system("pause");
-	return 0;
+	// Performs the search and displays the result
+	return displayResult(menuSolver.solve(stateBoard, searchAlgorithm::manhattanDistance, options),
+		"anytime A*(" + heuristicNames[4] + ") searching", "Nodes expanded");
 }
 
-int manhattanDistanceSearch()
+int displayResult(const searchResult& result, const string& method, const string& countName)
 {
-	// Message to let the user know what is going to happen
-	cout << "An A* search using the Manhattan distance will be performed and the result displayed." << endl << endl;
-
-	// Creates a string to represent the state
-	string stateStr;
-	for (int i = 0; i < 9; i++)
-	{
-		stateStr += to_string(initialState[i]);
-	}
-
-	// Counter used to keep track of the depth
-	int depthCounter = 0;
-
-	// Var to keep track of how many nodes were expanded
-	int nodesExpanded = 0;
-
-	// Creates a node to store the first state
-	node state;
-
-	// Fills in the data for the node
-	state.stateString = stateStr;
-	for (int i = 0; i < 9; i++)
-	{
-		state.stateArray[i] = initialState[i];
-	}
-	state.depth = depthCounter;
-	// Calculates the Manhattan distance
-	for (int i = 0; i < 9; i++)
+	// Checks to see if the search ended without reaching the goal
+	if (result.solved == false)
 	{
-		if (state.stateArray[i] != 0)
-		{
-			for (int j = 0; j < 9; j++)
-			{
-				if (state.stateArray[i] == goalStateArray[j])
-				{
-					state.heuristic += abs(i - j);
-				}
-			}
-		}
+		cout << endl << "No solution was found using " << method << "."
+			<< endl << "Depth reached was: " << result.depth
+			<< endl << countName << ": " << result.nodesExpanded << endl;
+		system("pause");
+		return 1;
 	}
-	state.heuristic += state.depth;
-	state.path.push_back(state.stateString);
-
-	// Puts the node in the priority queue
-	priorityQueue.push(state);
-
-	// Puts the current state and depth counter in the map
-	seenStates[stateStr] = depthCounter;
 
-	// Sentinel value for while loop exit condition
-	bool goalStateReached = false;
-
-	// Loops search until the goal state is found
-	while (goalStateReached == false)
+	// Displays how many nodes were expanded, by the earlier search when the solution was cached
+	if (result.cached)
 	{
-		// Checks to see if the the priority queue is empty
-		if (priorityQueue.empty())
-		{
-			//If so, then no solution was found since the loop didn't exit via sentinel value
-			cout << endl << "No solution was found using A*(Manhattan distance) searching."
-				<< endl << "Depth reached was: " << depthCounter
-				<< endl << "Nodes expanded: " << nodesExpanded << endl;
-			system("pause");
-			return 1;
-		}
-
-		// Checks to see if the next node in the priority queue has the goal state
-		if (priorityQueue.top().stateString == goalState)
-		{
-			// Sets sentinel value to true
-			goalStateReached = true;
-
-		}
-		// If the next node in the priority queue isn't the goal state
-		else
-		{
-			// Variable to let generateSuccessor function know to use the priority queue
-			int manhattanDistanceSearch = 4;
-
-			// Temp node to hold the state's data
-			node tempState;
-
-			// Copy the state's data to tempState
-			tempState.stateString = priorityQueue.top().stateString;
-			for (int i = 0; i < 9; i++)
-			{
-				tempState.stateArray[i] = priorityQueue.top().stateArray[i];
-			}
-			tempState.heuristic = priorityQueue.top().heuristic;
-			tempState.depth = priorityQueue.top().depth;
-			tempState.path = priorityQueue.top().path;
-
-			// Records the depth reached in case a solution isn't found
-			depthCounter = priorityQueue.top().depth;
-
-			// Pops the looked at state off the priority queue
-			priorityQueue.pop();
-
-			// Passes that state to a function to generate successor states
-			generateSuccessors(tempState, manhattanDistanceSearch);
-
-			// Records that a node was expanded
-			nodesExpanded += 1;
-		}
+		cout << "Solution found in the cache of earlier searches." << endl;
 	}
+	cout << countName << ": " << result.nodesExpanded << endl;
 
-	// Displays how many nodes were expanded
-	cout << "Nodes expanded: " << nodesExpanded << endl;
-
-	// Displays the depth of the solution
-	cout << "Depth of solution path: " << priorityQueue.top().depth << endl;
+	// Displays the depth of the solution and how long the search took
+	cout << "Depth of solution path: " << result.depth << endl;
 
-	// Creates an iterator to move through the list
-	list<string>::const_iterator it;
-	it = priorityQueue.top().path.begin();
-
-	// Moves through the list, displaying the solution path
-	for (it; it != priorityQueue.top().path.end(); ++it)
+	// Displays how far from the shortest path a weighted search might be
+	if (result.suboptimality > 1)
 	{
-		cout << *it << endl;
+		cout << "Path is at most " << result.suboptimality << " times the shortest." << endl;
 	}
+	cout << "Time taken: " << result.milliseconds << " ms" << endl;
 
-	// Empties the priority queue so it can be used again
-	while (!priorityQueue.empty())
+	// Displays the states from the initial state to the goal
+	for (size_t i = 0; i < result.path.size(); i++)
 	{
-		priorityQueue.pop();
+		cout << boardToString(result.path[i]) << endl;
 	}
 
-	// Empties the map
-	seenStates.clear();
-
 	system("pause");
 	return 0;
 }
 
-void generateSuccessors(node state, int num)
+bool parsePuzzle(const string& line, int cellCount, vector<int>& tiles)
 {
-	// String var used to check states in the map
-	string stateStr;
-
-	// Finds the index value of the 0 (blank piece) in the state array
-	int blankIndex = 0;
-	for (int i = 0; i < 9; i++)
-	{
-		// Records the index of the blank piece in a var
-		if (state.stateArray[i] == 0)
-		{
-			blankIndex = i;
-		}
-	}
-
-	// Vars used to swap the values
-	int temp1 = 0;
-	int temp2 = 0;
-
-	// Series of if statements that will create successor states depending on the blankIndex
-	if (blankIndex == 0)
-	{
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
-		{
-			workingState[i] = state.stateArray[i];
-		}
-
-		// Vars used to swap the values
-		temp1 = workingState[0];
-		temp2 = workingState[1];
-		
-		// Swaps the array values
-		workingState[0] = temp2;
-		workingState[1] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
-		{
-			stateStr += to_string(workingState[i]);
-		}
-
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
-		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
-
-		}
-
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
-		{
-			workingState[i] = state.stateArray[i];
-		}
-
-		// Vars used to swap the values
-		temp1 = workingState[0];
-		temp2 = workingState[3];
-
-		// Swaps array values
-		workingState[0] = temp2;
-		workingState[3] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
-		{
-			stateStr += to_string(workingState[i]);
-		}
-
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
-		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
-		}
-	}
-
-	else if (blankIndex == 1)
-	{
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
-		{
-			workingState[i] = state.stateArray[i];
-		}
-
-		// Vars used to swap the values
-		temp1 = workingState[1];
-		temp2 = workingState[2];
-
-		// Swaps array values
-		workingState[1] = temp2;
-		workingState[2] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
-		{
-			stateStr += to_string(workingState[i]);
-		}
-
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
-		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
-		}
-			// Copies the state in the node into the working state
-			for (int i = 0; i < 9; i++)
-			{
-				workingState[i] = state.stateArray[i];
-			}
-
-			// Vars used to swap the values
-			temp1 = workingState[1];
-			temp2 = workingState[4];
-
-			// Swaps array values
-			workingState[1] = temp2;
-			workingState[4] = temp1;
-
-			// Empties out stateStr 
-			stateStr = "";
+	// Which tiles have been seen
+	vector <bool> seen(cellCount, false);
 
-			// Converts the workingState to a string to be checked
-			for (int i = 0; i < 9; i++)
-			{
-				stateStr += to_string(workingState[i]);
-			}
-
-			// Checks to see if that state has been seen
-			if (checkSeenStates(stateStr) == false)
-			{
-				// Creates a node to store the state
-				node newState;
-
-				// Fills in the data for the node
-				newState.stateString = stateStr;
-				for (int i = 0; i < 9; i++)
-				{
-					newState.stateArray[i] = workingState[i];
-				}
-				newState.depth = state.depth + 1;
-				// Depending on the type of search, will calculate either the number of misplaced tiles
-				// or the Manhattan distance for the heuristic
-				if (num == 3)
-				{
-					for (int i = 0; i < 9; i++)
-					{
-						if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-						{
-							newState.heuristic += 1;
-						}
-					}
-				}
-				else if (num == 4)
-				{
-					for (int i = 0; i < 9; i++)
-					{
-						if (state.stateArray[i] != 0)
-						{
-							for (int j = 0; j < 9; j++)
-							{
-								if (state.stateArray[i] == goalStateArray[j])
-								{
-									state.heuristic += abs(i - j);
-								}
-							}
-						}
-					}
-				}
-				newState.heuristic += newState.depth;
-				// Records the path unless a depth first search is being performed
-				if (num != 2)
-				{
-					newState.path = state.path;
-					newState.path.push_back(stateStr);
-				}
-
-				// If the variable passed in is a 1, pushes to queue
-				// If the variable passed in is a 2, pushes to stack
-				// If the variable passed in is a 3 or 4, pushes to priority queue
-				if (num == 1)
-				{
-					nodeQueue.push(newState);
-				}
-				else if (num == 2)
-				{
-					nodeStack.push(newState);
-				}
-				else if (num == 3 || num == 4)
-				{
-					priorityQueue.push(newState);
-				}
-
-				// Records the state and depth in the map
-				seenStates[newState.stateString] = newState.depth;
-			}
-				// Copies the state in the node into the working state
-				for (int i = 0; i < 9; i++)
-				{
-					workingState[i] = state.stateArray[i];
-				}
-
-				// Vars used to swap the values
-				temp1 = workingState[1];
-				temp2 = workingState[0];
-
-				// Swaps array values
-				workingState[1] = temp2;
-				workingState[0] = temp1;
-
-				// Empties out stateStr 
-				stateStr = "";
-
-				// Converts the workingState to a string to be checked
-				for (int i = 0; i < 9; i++)
-				{
-					stateStr += to_string(workingState[i]);
-				}
-
-				// Checks to see if that state has been seen
-				if (checkSeenStates(stateStr) == false)
-				{
-					// Creates a node to store the state
-					node newState;
-
-					// Fills in the data for the node
-					newState.stateString = stateStr;
-					for (int i = 0; i < 9; i++)
-					{
-						newState.stateArray[i] = workingState[i];
-					}
-					newState.depth = state.depth + 1;
-					// Depending on the type of search, will calculate either the number of misplaced tiles
-					// or the Manhattan distance for the heuristic
-					if (num == 3)
-					{
-						for (int i = 0; i < 9; i++)
-						{
-							if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-							{
-								newState.heuristic += 1;
-							}
-						}
-					}
-					else if (num == 4)
-					{
-						for (int i = 0; i < 9; i++)
-						{
-							if (state.stateArray[i] != 0)
-							{
-								for (int j = 0; j < 9; j++)
-								{
-									if (state.stateArray[i] == goalStateArray[j])
-									{
-										state.heuristic += abs(i - j);
-									}
-								}
-							}
-						}
-					}
-					newState.heuristic += newState.depth;
-					// Records the path unless a depth first search is being performed
-					if (num != 2)
-					{
-						newState.path = state.path;
-						newState.path.push_back(stateStr);
-					}
-
-					// If the variable passed in is a 1, pushes to queue
-					// If the variable passed in is a 2, pushes to stack
-					// If the variable passed in is a 3 or 4, pushes to priority queue
-					if (num == 1)
-					{
-						nodeQueue.push(newState);
-					}
-					else if (num == 2)
-					{
-						nodeStack.push(newState);
-					}
-					else if (num == 3 || num == 4)
-					{
-						priorityQueue.push(newState);
-					}
-
-					// Records the state and depth in the map
-					seenStates[newState.stateString] = newState.depth;
-				}
-			}
-
-	else if (blankIndex == 2)
+	// Reads each number, separated by spaces, commas or the carriage return of Windows line endings
+	size_t i = 0;
+	while (i < line.size())
 	{
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
+		char c = line[i];
+		if (c == ' ' || c == '\t' || c == ',' || c == '\r')
 		{
-			workingState[i] = state.stateArray[i];
+			i += 1;
+			continue;
 		}
 
-		// Vars used to swap the values
-		temp1 = workingState[2];
-		temp2 = workingState[5];
-
-		// Swaps array values
-		workingState[2] = temp2;
-		workingState[5] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
+		// Reads the digits of the number
+		int tile = 0;
+		size_t start = i;
+		while (i < line.size() && line[i] >= '0' && line[i] <= '9' && i - start < 3)
 		{
-			stateStr += to_string(workingState[i]);
+			tile = tile * 10 + (line[i] - '0');
+			i += 1;
 		}
 
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
+		// Rejects anything other than each tile from 0 to the last exactly once
+		if (i == start || tile >= cellCount || seen[tile] || (int)tiles.size() == cellCount)
 		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
+			return false;
 		}
 
-			// Copies the state in the node into the working state
-			for (int i = 0; i < 9; i++)
-			{
-				workingState[i] = state.stateArray[i];
-			}
-
-			// Vars used to swap the values
-			temp1 = workingState[2];
-			temp2 = workingState[1];
-
-			// Swaps array values
-			workingState[2] = temp2;
-			workingState[1] = temp1;
-
-			// Empties out stateStr 
-			stateStr = "";
-
-			// Converts the workingState to a string to be checked
-			for (int i = 0; i < 9; i++)
-			{
-				stateStr += to_string(workingState[i]);
-			}
-
-			// Checks to see if that state has been seen
-			if (checkSeenStates(stateStr) == false)
-			{
-				// Creates a node to store the state
-				node newState;
-
-				// Fills in the data for the node
-				newState.stateString = stateStr;
-				for (int i = 0; i < 9; i++)
-				{
-					newState.stateArray[i] = workingState[i];
-				}
-				newState.depth = state.depth + 1;
-				// Depending on the type of search, will calculate either the number of misplaced tiles
-				// or the Manhattan distance for the heuristic
-				if (num == 3)
-				{
-					for (int i = 0; i < 9; i++)
-					{
-						if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-						{
-							newState.heuristic += 1;
-						}
-					}
-				}
-				else if (num == 4)
-				{
-					for (int i = 0; i < 9; i++)
-					{
-						if (state.stateArray[i] != 0)
-						{
-							for (int j = 0; j < 9; j++)
-							{
-								if (state.stateArray[i] == goalStateArray[j])
-								{
-									state.heuristic += abs(i - j);
-								}
-							}
-						}
-					}
-				}
-				newState.heuristic += newState.depth;
-				// Records the path unless a depth first search is being performed
-				if (num != 2)
-				{
-					newState.path = state.path;
-					newState.path.push_back(stateStr);
-				}
-
-				// If the variable passed in is a 1, pushes to queue
-				// If the variable passed in is a 2, pushes to stack
-				// If the variable passed in is a 3 or 4, pushes to priority queue
-				if (num == 1)
-				{
-					nodeQueue.push(newState);
-				}
-				else if (num == 2)
-				{
-					nodeStack.push(newState);
-				}
-				else if (num == 3 || num == 4)
-				{
-					priorityQueue.push(newState);
-				}
-
-				// Records the state and depth in the map
-				seenStates[newState.stateString] = newState.depth;
-			}
+		seen[tile] = true;
+		tiles.push_back(tile);
 	}
 
-	else if (blankIndex == 3)
-	{
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
-		{
-			workingState[i] = state.stateArray[i];
-		}
-
-		// Vars used to swap the values
-		temp1 = workingState[3];
-		temp2 = workingState[0];
-
-		// Swaps array values
-		workingState[3] = temp2;
-		workingState[0] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
-		{
-			stateStr += to_string(workingState[i]);
-		}
-
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
-		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
-		}
-
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
-		{
-			workingState[i] = state.stateArray[i];
-		}
-
-		// Vars used to swap the values
-		temp1 = workingState[3];
-		temp2 = workingState[4];
-
-		// Swaps array values
-		workingState[3] = temp2;
-		workingState[4] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
-		{
-			stateStr += to_string(workingState[i]);
-		}
-
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
-		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
-		}
-
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
-		{
-			workingState[i] = state.stateArray[i];
-		}
-
-		// Vars used to swap the values
-		temp1 = workingState[3];
-		temp2 = workingState[6];
-
-		// Swaps array values
-		workingState[3] = temp2;
-		workingState[6] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
-		{
-			stateStr += to_string(workingState[i]);
-		}
-
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
-		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
-		}
-	}
-
-	else if (blankIndex == 4)
-	{
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
-		{
-			workingState[i] = state.stateArray[i];
-		}
-
-		// Vars used to swap the values
-		temp1 = workingState[4];
-		temp2 = workingState[1];
-
-		// Swaps array values
-		workingState[4] = temp2;
-		workingState[1] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
-		{
-			stateStr += to_string(workingState[i]);
-		}
-
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
-		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
-		}
-
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
-		{
-			workingState[i] = state.stateArray[i];
-		}
-
-		// Vars used to swap the values
-		temp1 = workingState[4];
-		temp2 = workingState[5];
-
-		// Swaps array values
-		workingState[4] = temp2;
-		workingState[5] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
-		{
-			stateStr += to_string(workingState[i]);
-		}
-
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
-		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
-		}
-
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
-		{
-			workingState[i] = state.stateArray[i];
-		}
-
-		// Vars used to swap the values
-		temp1 = workingState[4];
-		temp2 = workingState[7];
-
-		// Swaps array values
-		workingState[4] = temp2;
-		workingState[7] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
-		{
-			stateStr += to_string(workingState[i]);
-		}
-
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
-		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
-		}
-
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
-		{
-			workingState[i] = state.stateArray[i];
-		}
-
-		// Vars used to swap the values
-		temp1 = workingState[4];
-		temp2 = workingState[3];
-
-		// Swaps array values
-		workingState[4] = temp2;
-		workingState[3] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
-		{
-			stateStr += to_string(workingState[i]);
-		}
-
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
-		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
-		}
-	}
-
-	else if (blankIndex == 5)
-	{
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
-		{
-			workingState[i] = state.stateArray[i];
-		}
-
-		// Vars used to swap the values
-		temp1 = workingState[5];
-		temp2 = workingState[2];
-
-		// Swaps array values
-		workingState[5] = temp2;
-		workingState[2] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
-		{
-			stateStr += to_string(workingState[i]);
-		}
-
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
-		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
-		}
-
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
-		{
-			workingState[i] = state.stateArray[i];
-		}
-
-		// Vars used to swap the values
-		temp1 = workingState[5];
-		temp2 = workingState[8];
-
-		// Swaps array values
-		workingState[5] = temp2;
-		workingState[8] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
-		{
-			stateStr += to_string(workingState[i]);
-		}
-
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
-		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
-		}
-
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
-		{
-			workingState[i] = state.stateArray[i];
-		}
-
-		// Vars used to swap the values
-		temp1 = workingState[5];
-		temp2 = workingState[4];
-
-		// Swaps array values
-		workingState[5] = temp2;
-		workingState[4] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
-		{
-			stateStr += to_string(workingState[i]);
-		}
-
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
-		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
-		}
-	}
-
-	else if (blankIndex == 6)
-	{
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
-		{
-			workingState[i] = state.stateArray[i];
-		}
-
-		// Vars used to swap the values
-		temp1 = workingState[6];
-		temp2 = workingState[3];
-
-		// Swaps array values
-		workingState[6] = temp2;
-		workingState[3] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
-		{
-			stateStr += to_string(workingState[i]);
-		}
-
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
-		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
-		}
-
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
-		{
-			workingState[i] = state.stateArray[i];
-		}
-
-		// Vars used to swap the values
-		temp1 = workingState[6];
-		temp2 = workingState[7];
-
-		// Swaps array values
-		workingState[6] = temp2;
-		workingState[7] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
-		{
-			stateStr += to_string(workingState[i]);
-		}
-
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
-		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
-		}
-	}
-
-	else if (blankIndex == 7)
-	{
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
-		{
-			workingState[i] = state.stateArray[i];
-		}
-
-		// Vars used to swap the values
-		temp1 = workingState[7];
-		temp2 = workingState[4];
-
-		// Swaps array values
-		workingState[7] = temp2;
-		workingState[4] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
-		{
-			stateStr += to_string(workingState[i]);
-		}
-
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
-		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
-		}
-
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
-		{
-			workingState[i] = state.stateArray[i];
-		}
-
-		// Vars used to swap the values
-		temp1 = workingState[7];
-		temp2 = workingState[8];
-
-		// Swaps array values
-		workingState[7] = temp2;
-		workingState[8] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
-		{
-			stateStr += to_string(workingState[i]);
-		}
-
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
-		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
-		}
-
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
-		{
-			workingState[i] = state.stateArray[i];
-		}
-
-		// Vars used to swap the values
-		temp1 = workingState[7];
-		temp2 = workingState[6];
-
-		// Swaps array values
-		workingState[7] = temp2;
-		workingState[6] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
-		{
-			stateStr += to_string(workingState[i]);
-		}
-
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
-		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
-		}
-	}
-
-	else if (blankIndex == 8)
-	{
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
-		{
-			workingState[i] = state.stateArray[i];
-		}
-
-		// Vars used to swap the values
-		temp1 = workingState[8];
-		temp2 = workingState[5];
-
-		// Swaps array values
-		workingState[8] = temp2;
-		workingState[5] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
-		{
-			stateStr += to_string(workingState[i]);
-		}
-
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
-		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
-		}
-
-		// Copies the state in the node into the working state
-		for (int i = 0; i < 9; i++)
-		{
-			workingState[i] = state.stateArray[i];
-		}
-
-		// Vars used to swap the values
-		temp1 = workingState[8];
-		temp2 = workingState[7];
-
-		// Swaps array values
-		workingState[8] = temp2;
-		workingState[7] = temp1;
-
-		// Empties out stateStr 
-		stateStr = "";
-
-		// Converts the workingState to a string to be checked
-		for (int i = 0; i < 9; i++)
-		{
-			stateStr += to_string(workingState[i]);
-		}
-
-		// Checks to see if that state has been seen
-		if (checkSeenStates(stateStr) == false)
-		{
-			// Creates a node to store the state
-			node newState;
-
-			// Fills in the data for the node
-			newState.stateString = stateStr;
-			for (int i = 0; i < 9; i++)
-			{
-				newState.stateArray[i] = workingState[i];
-			}
-			newState.depth = state.depth + 1;
-			// Depending on the type of search, will calculate either the number of misplaced tiles
-			// or the Manhattan distance for the heuristic
-			if (num == 3)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (newState.stateArray[i] != 0 && newState.stateArray[i] != goalStateArray[i])
-					{
-						newState.heuristic += 1;
-					}
-				}
-			}
-			else if (num == 4)
-			{
-				for (int i = 0; i < 9; i++)
-				{
-					if (state.stateArray[i] != 0)
-					{
-						for (int j = 0; j < 9; j++)
-						{
-							if (state.stateArray[i] == goalStateArray[j])
-							{
-								state.heuristic += abs(i - j);
-							}
-						}
-					}
-				}
-			}
-			newState.heuristic += newState.depth;
-			// Records the path unless a depth first search is being performed
-			if (num != 2)
-			{
-				newState.path = state.path;
-				newState.path.push_back(stateStr);
-			}
-
-			// If the variable passed in is a 1, pushes to queue
-			// If the variable passed in is a 2, pushes to stack
-			// If the variable passed in is a 3 or 4, pushes to priority queue
-			if (num == 1)
-			{
-				nodeQueue.push(newState);
-			}
-			else if (num == 2)
-			{
-				nodeStack.push(newState);
-			}
-			else if (num == 3 || num == 4)
-			{
-				priorityQueue.push(newState);
-			}
-
-			// Records the state and depth in the map
-			seenStates[newState.stateString] = newState.depth;
-		}
-	}
-
-}
-
-bool checkSeenStates(string state)
-{
-	// Creates an iterator to run through the map to see if the state is there
-	map<string, int>::iterator it;
-	it = seenStates.find(state);
-	
-	if (it == seenStates.end())
-	{
-		// If the state isn't in the map, returns false
-		return false;
-	}
-	else
-	{
-		// If the state is in the map, returns true
-		return true;
-	}
-	
+	return (int)tiles.size() == cellCount;
 }
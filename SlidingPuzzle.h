@@ -0,0 +1,384 @@
+/**************************************************************************************************
+* Sliding Puzzle Shapes
+* Move tables, heuristic tables and an IDA* search for sliding puzzles of any number of rows and
+* columns, all worked out at compile time from the shape. The 8 puzzle searches in Solver.cpp use
+* the 3x3 tables directly with their packed boards, and the 15 and 24 puzzles are solved by the
+* 4x4 and 5x5 versions of the search here.
+**************************************************************************************************/
+
+#ifndef SLIDING_PUZZLE_H
+#define SLIDING_PUZZLE_H
+
+#include<chrono>
+#include<cstdint>
+#include<limits>
+#include<string>
+#include<vector>
+
+// Entry in the move table describing one legal slide of the blank
+struct blankMove
+{
+	// Index of the tile that slides into the blank
+	int target;
+
+	// Direction the blank travels (0 up, 1 right, 2 down, 3 left)
+	int direction;
+};
+
+// Legal moves of the blank for each blank index of a puzzle, ordered up, right, down, left
+template <int Rows, int Columns>
+struct shapeMoves
+{
+	int counts[Rows * Columns];
+	blankMove moves[Rows * Columns][4];
+};
+
+// Table holding a heuristic's contribution for every tile at every position of a puzzle
+template <int Rows, int Columns>
+struct shapeTable
+{
+	int value[Rows * Columns][Rows * Columns];
+};
+
+// Tile the goal state has at an index. The tiles are in order with the blank last
+template <int Rows, int Columns>
+constexpr int goalTile(int index)
+{
+	return index == Rows * Columns - 1 ? 0 : index + 1;
+}
+
+// Index a tile has in the goal state
+template <int Rows, int Columns>
+constexpr int goalIndex(int tile)
+{
+	return tile == 0 ? Rows * Columns - 1 : tile - 1;
+}
+
+// Builds the move table by trying each direction from every blank index
+template <int Rows, int Columns>
+constexpr shapeMoves<Rows, Columns> buildShapeMoves()
+{
+	shapeMoves<Rows, Columns> table = {};
+	for (int i = 0; i < Rows * Columns; i++)
+	{
+		int row = i / Columns;
+		int column = i % Columns;
+		if (row > 0)
+		{
+			table.moves[i][table.counts[i]++] = { i - Columns, 0 };
+		}
+		if (column < Columns - 1)
+		{
+			table.moves[i][table.counts[i]++] = { i + 1, 1 };
+		}
+		if (row < Rows - 1)
+		{
+			table.moves[i][table.counts[i]++] = { i + Columns, 2 };
+		}
+		if (column > 0)
+		{
+			table.moves[i][table.counts[i]++] = { i - 1, 3 };
+		}
+	}
+	return table;
+}
+
+// Builds the table of row plus column distances between each position and the
+// position the tile has in the goal state. The blank contributes nothing
+template <int Rows, int Columns>
+constexpr shapeTable<Rows, Columns> buildManhattanTable()
+{
+	shapeTable<Rows, Columns> table = {};
+	for (int tile = 1; tile < Rows * Columns; tile++)
+	{
+		int goal = goalIndex<Rows, Columns>(tile);
+		for (int i = 0; i < Rows * Columns; i++)
+		{
+			int rowDistance = i / Columns - goal / Columns;
+			int columnDistance = i % Columns - goal % Columns;
+			table.value[tile][i] = (rowDistance < 0 ? -rowDistance : rowDistance)
+				+ (columnDistance < 0 ? -columnDistance : columnDistance);
+		}
+	}
+	return table;
+}
+
+// Builds the table marking each position where a tile is misplaced. The blank is never counted
+template <int Rows, int Columns>
+constexpr shapeTable<Rows, Columns> buildMisplacedTable()
+{
+	shapeTable<Rows, Columns> table = {};
+	for (int tile = 1; tile < Rows * Columns; tile++)
+	{
+		for (int i = 0; i < Rows * Columns; i++)
+		{
+			table.value[tile][i] = (goalTile<Rows, Columns>(i) != tile) ? 1 : 0;
+		}
+	}
+	return table;
+}
+
+// Tables of each shape, built once per shape the program uses
+template <int Rows, int Columns>
+constexpr shapeMoves<Rows, Columns> moveTables = buildShapeMoves<Rows, Columns>();
+template <int Rows, int Columns>
+constexpr shapeTable<Rows, Columns> manhattanTables = buildManhattanTable<Rows, Columns>();
+template <int Rows, int Columns>
+constexpr shapeTable<Rows, Columns> misplacedTables = buildMisplacedTable<Rows, Columns>();
+
+// State of a puzzle larger than the 8 puzzle, which no longer fits a packed board. The
+// blank index is kept alongside the tiles so moves don't have to look for it
+template <int Rows, int Columns>
+struct puzzleState
+{
+	uint8_t tiles[Rows * Columns];
+	int blankIndex;
+};
+
+// Outcome of solving a puzzle of any shape. The solution is given as the moves of the
+// blank, written with the letters U, R, D and L
+struct puzzleResult
+{
+	bool solvable = true;
+	bool solved = false;
+	int depth = 0;
+	long long nodesExpanded = 0;
+	double milliseconds = 0;
+	std::string moves;
+};
+
+// Whether a puzzle can reach the goal. Each move changes the number of inversions by the
+// number of tiles it passes, so with an odd number of columns the inversions stay even, and
+// with an even number their parity changes every time the blank changes row
+template <int Rows, int Columns>
+bool puzzleSolvable(const puzzleState<Rows, Columns>& state)
+{
+	int inversions = 0;
+	for (int i = 0; i < Rows * Columns; i++)
+	{
+		for (int j = i + 1; j < Rows * Columns; j++)
+		{
+			if (state.tiles[i] != 0 && state.tiles[j] != 0 && state.tiles[i] > state.tiles[j])
+			{
+				inversions += 1;
+			}
+		}
+	}
+
+	int blankRowsUp = Columns % 2 == 0 ? Rows - 1 - state.blankIndex / Columns : 0;
+	return (inversions + blankRowsUp) % 2 == 0;
+}
+
+// Works out the linear conflict penalty of one row, or one column when column is true, reading
+// its tiles from a board of the shape laid out in board order. Tiles whose goal is in this line
+// are listed by their goal position along it, and every tile that has to leave the line so the
+// rest are in order costs two extra moves
+template <int Rows, int Columns, typename Tile>
+constexpr int lineConflicts(const Tile* tiles, int line, bool column)
+{
+	// Goal offsets along the line of the tiles that belong in it, and the longest in order
+	// run ending at each of them
+	int goalOffsets[Rows > Columns ? Rows : Columns] = {};
+	int runs[Rows > Columns ? Rows : Columns] = {};
+	int count = 0;
+	int longestRun = 0;
+
+	int length = column ? Rows : Columns;
+	for (int i = 0; i < length; i++)
+	{
+		int tile = column ? tiles[i * Columns + line] : tiles[line * Columns + i];
+		int goal = goalIndex<Rows, Columns>(tile);
+		if (tile != 0 && (column ? goal % Columns : goal / Columns) == line)
+		{
+			goalOffsets[count] = column ? goal / Columns : goal % Columns;
+			runs[count] = 1;
+			for (int j = 0; j < count; j++)
+			{
+				if (goalOffsets[j] < goalOffsets[count] && runs[j] + 1 > runs[count])
+				{
+					runs[count] = runs[j] + 1;
+				}
+			}
+			if (runs[count] > longestRun)
+			{
+				longestRun = runs[count];
+			}
+			count += 1;
+		}
+	}
+
+	return 2 * (count - longestRun);
+}
+
+// Works out the linear conflict penalty of one row or column of a state
+template <int Rows, int Columns>
+int puzzleLineConflicts(const puzzleState<Rows, Columns>& state, int line, bool column)
+{
+	return lineConflicts<Rows, Columns>(state.tiles, line, column);
+}
+
+// Calculates the Manhattan distance plus linear conflicts heuristic of a whole state
+template <int Rows, int Columns>
+int puzzleHeuristic(const puzzleState<Rows, Columns>& state)
+{
+	int heuristic = 0;
+	for (int i = 0; i < Rows * Columns; i++)
+	{
+		heuristic += manhattanTables<Rows, Columns>.value[state.tiles[i]][i];
+	}
+	for (int row = 0; row < Rows; row++)
+	{
+		heuristic += puzzleLineConflicts<Rows, Columns>(state, row, false);
+	}
+	for (int column = 0; column < Columns; column++)
+	{
+		heuristic += puzzleLineConflicts<Rows, Columns>(state, column, true);
+	}
+	return heuristic;
+}
+
+// Slides the tile at the target index into the blank, returning the heuristic of the new
+// state. Only the tile moves, so its distance changes by one, and the conflicts can only
+// change in the line across the move that is the tile's goal line, since that is the one
+// line whose tiles that count are joined or left by it
+template <int Rows, int Columns>
+int puzzleSlide(puzzleState<Rows, Columns>& state, int target, int heuristic)
+{
+	int blankIndex = state.blankIndex;
+	int tile = state.tiles[target];
+
+	// A tile sliding up or down changes row and keeps its place among the tiles of its
+	// column, and a tile sliding sideways changes column and keeps its place in its row
+	bool column = target % Columns != blankIndex % Columns;
+	int goal = goalIndex<Rows, Columns>(tile);
+	int goalLine = column ? goal % Columns : goal / Columns;
+	bool conflictsChange = goalLine == (column ? target % Columns : target / Columns)
+		|| goalLine == (column ? blankIndex % Columns : blankIndex / Columns);
+
+	heuristic -= manhattanTables<Rows, Columns>.value[tile][target];
+	if (conflictsChange)
+	{
+		heuristic -= puzzleLineConflicts<Rows, Columns>(state, goalLine, column);
+	}
+
+	state.tiles[blankIndex] = (uint8_t)tile;
+	state.tiles[target] = 0;
+	state.blankIndex = target;
+
+	heuristic += manhattanTables<Rows, Columns>.value[tile][blankIndex];
+	if (conflictsChange)
+	{
+		heuristic += puzzleLineConflicts<Rows, Columns>(state, goalLine, column);
+	}
+
+	return heuristic;
+}
+
+// Probes below the state reached by the moves so far, going no further than the bound.
+// Returns -1 when the goal is reached, leaving the solution in the moves, or else the
+// smallest cost found over the bound
+template <int Rows, int Columns>
+int puzzleProbe(puzzleState<Rows, Columns>& state, std::string& moves, int heuristic, int bound,
+	int lastDirection, long long& nodesExpanded)
+{
+	// Stops going deeper once the cost goes over the bound
+	int depth = (int)moves.size();
+	if (depth + heuristic > bound)
+	{
+		return depth + heuristic;
+	}
+
+	// The heuristic never overestimates and is only zero at the goal
+	if (heuristic == 0)
+	{
+		return -1;
+	}
+
+	// Records that a node was expanded
+	nodesExpanded += 1;
+
+	// Smallest cost found over the bound below this state
+	int nextBound = std::numeric_limits<int>::max();
+
+	int blankIndex = state.blankIndex;
+	for (int m = 0; m < moveTables<Rows, Columns>.counts[blankIndex]; m++)
+	{
+		// Skips the move that would slide the blank straight back where it came from
+		int direction = moveTables<Rows, Columns>.moves[blankIndex][m].direction;
+		if (lastDirection != -1 && direction == (lastDirection + 2) % 4)
+		{
+			continue;
+		}
+
+		// Slides the tile into the blank and probes below the new state
+		int target = moveTables<Rows, Columns>.moves[blankIndex][m].target;
+		int nextHeuristic = puzzleSlide<Rows, Columns>(state, target, heuristic);
+		moves.push_back("URDL"[direction]);
+
+		int result = puzzleProbe<Rows, Columns>(state, moves, nextHeuristic, bound, direction, nodesExpanded);
+		if (result == -1)
+		{
+			return -1;
+		}
+
+		// Slides the tile back, takes the move off and keeps the smallest cost over the bound
+		moves.pop_back();
+		puzzleSlide<Rows, Columns>(state, blankIndex, nextHeuristic);
+		if (result < nextBound)
+		{
+			nextBound = result;
+		}
+	}
+
+	return nextBound;
+}
+
+// Solves a puzzle with IDA* and the Manhattan distance plus linear conflicts heuristic. The
+// tiles are given in board order with 0 for the blank and must hold each tile once
+template <int Rows, int Columns>
+puzzleResult solvePuzzle(const std::vector<int>& tiles)
+{
+	// Times the search from start to finish
+	std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+	// Result of the search and the state it slides tiles around in
+	puzzleResult result;
+	puzzleState<Rows, Columns> state;
+	for (int i = 0; i < Rows * Columns; i++)
+	{
+		state.tiles[i] = (uint8_t)tiles[i];
+		if (tiles[i] == 0)
+		{
+			state.blankIndex = i;
+		}
+	}
+
+	// Reports start states that can never reach the goal without searching
+	if (puzzleSolvable<Rows, Columns>(state) == false)
+	{
+		result.solvable = false;
+	}
+	else
+	{
+		// Probes deeper and deeper, raising the bound to the smallest cost that went over it,
+		// until a probe reaches the goal
+		int heuristic = puzzleHeuristic<Rows, Columns>(state);
+		int bound = heuristic;
+		int probe = puzzleProbe<Rows, Columns>(state, result.moves, heuristic, bound, -1, result.nodesExpanded);
+		while (probe != -1)
+		{
+			bound = probe;
+			probe = puzzleProbe<Rows, Columns>(state, result.moves, heuristic, bound, -1, result.nodesExpanded);
+		}
+
+		// The moves the final probe made are the solution
+		result.solved = true;
+		result.depth = (int)result.moves.size();
+	}
+
+	// Records how long the search took
+	result.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+	return result;
+}
+
+#endif
@@ -0,0 +1,3127 @@
+/**************************************************************************************************
+* 8 Slider Puzzle Solver
+* The searches behind Solver.h: breadth first, depth limited and iterative deepening depth first,
+* bidirectional, A* with four different heuristics, IDA*, parallel A* and a walk down an exact
+* distance oracle, along with the packed boards, move tables, heuristic tables and pattern database
+* they share and the cache of solutions in front of them.
+**************************************************************************************************/
+
+#include "Solver.h"
+#include "SlidingPuzzle.h"
+
+#include<iostream>
+#include<string>
+#include<algorithm>
+#include<vector>
+#include<bitset>
+#include<limits>
+#include<cstdint>
+#include<cstring>
+#include<cstdio>
+#include<deque>
+#include<fstream>
+#include<atomic>
+#include<thread>
+#include<memory>
+#include<mutex>
+#include<unordered_map>
+#include<array>
+#include<chrono>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include<windows.h>
+#else
+#include<sys/mman.h>
+#include<sys/stat.h>
+#include<fcntl.h>
+#include<unistd.h>
+#endif
+
+// The batched heuristic kernels have an AVX2 version on x86 processors, compiled for AVX2
+// on its own so the rest of the program still runs on processors without it
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define VECTOR_KERNELS
+#include<immintrin.h>
+#ifdef _MSC_VER
+#include<intrin.h>
+#define TARGET_AVX2
+#else
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+using namespace std;
+
+// Bit position of the cached blank index inside a board
+const int blankShift = 36;
+
+// Node used during solution searches
+struct node
+{
+	// Packed board used to represent the environment state
+	board stateBoard = 0;
+
+	// Int used to hold the value representing the depth of the search tree
+	int depth = 0;
+
+	// Heuristic estimate of the distance to the goal used for the A* searches
+	int heuristic = 0;
+
+	// Index of the parent node in the node pool, -1 for the initial state
+	int parent = -1;
+
+	// Direction the blank travelled to reach this state from its parent
+	int direction = -1;
+};
+
+// Number of depths the bucket queue tells apart within one cost. No 8 puzzle state is
+// more than 31 moves from the goal, so A* never reaches a depth past this
+const int bucketDepths = 64;
+
+// Priority queue for the A* searches. Costs are small whole numbers, so instead of a heap
+// there is one bucket of node indexes per key. The key orders by lowest cost first and
+// then by greatest depth, and the lowest key that might hold a node is remembered, so
+// pushing is an append and popping takes from the back of the lowest non-empty bucket.
+// Each queued node's key and slot in its bucket are indexed by node, so a node can be
+// found and moved to a lower key instead of being queued a second time
+struct bucketQueue
+{
+	// Buckets of node indexes, indexed by key
+	vector <vector <int>> buckets;
+
+	// Key and bucket slot of each node, indexed by node. The slot is -1 when not queued
+	vector <size_t> keys;
+	vector <int> slots;
+
+	// Lowest key that might hold a node, and the number of nodes held
+	size_t lowestKey = 0;
+	int count = 0;
+
+	// Checks to see if the queue holds no nodes
+	bool empty() const
+	{
+		return count == 0;
+	}
+
+	// Checks to see if the node with the given index is waiting in the queue
+	bool contains(int index) const
+	{
+		return (size_t)index < slots.size() && slots[index] != -1;
+	}
+
+	// Adds a node index with the given cost and depth
+	void push(int cost, int depth, int index)
+	{
+		// Deeper nodes get lower keys within the same cost
+		size_t key = (size_t)cost * bucketDepths + (bucketDepths - 1 - min(depth, bucketDepths - 1));
+		if (key >= buckets.size())
+		{
+			buckets.resize(key + 1);
+		}
+		if ((size_t)index >= slots.size())
+		{
+			keys.resize(index + 1);
+			slots.resize(index + 1, -1);
+		}
+
+		keys[index] = key;
+		slots[index] = (int)buckets[key].size();
+		buckets[key].push_back(index);
+		count += 1;
+		if (key < lowestKey)
+		{
+			lowestKey = key;
+		}
+	}
+
+	// Returns the index of the node that would be popped next
+	int top()
+	{
+		while (buckets[lowestKey].empty())
+		{
+			lowestKey += 1;
+		}
+		return buckets[lowestKey].back();
+	}
+
+	// Removes and returns the index of the lowest cost, deepest node
+	int pop()
+	{
+		int index = top();
+		buckets[lowestKey].pop_back();
+		slots[index] = -1;
+		count -= 1;
+		return index;
+	}
+
+	// Takes a queued node out of its bucket by moving the bucket's last node into its slot
+	void remove(int index)
+	{
+		vector <int>& bucket = buckets[keys[index]];
+		int last = bucket.back();
+		bucket[slots[index]] = last;
+		slots[last] = slots[index];
+		bucket.pop_back();
+		slots[index] = -1;
+		count -= 1;
+	}
+
+	// Moves a queued node to the key for its lowered cost and depth
+	void decreaseKey(int cost, int depth, int index)
+	{
+		remove(index);
+		push(cost, depth, index);
+	}
+
+	// Returns the cost of the node that would be popped next
+	int topCost()
+	{
+		top();
+		return (int)(lowestKey / bucketDepths);
+	}
+
+	// Takes every queued node out, adding their indexes to the list, so they can be queued
+	// again under different costs
+	void drain(vector<int>& indexes)
+	{
+		for (size_t key = lowestKey; key < buckets.size() && count > 0; key++)
+		{
+			for (size_t i = 0; i < buckets[key].size(); i++)
+			{
+				indexes.push_back(buckets[key][i]);
+				slots[buckets[key][i]] = -1;
+				count -= 1;
+			}
+			buckets[key].clear();
+		}
+		lowestKey = 0;
+	}
+
+	// Empties every bucket, keeping their capacity for the next search
+	void clear()
+	{
+		for (size_t key = 0; key < buckets.size(); key++)
+		{
+			buckets[key].clear();
+		}
+		keys.clear();
+		slots.clear();
+		lowestKey = 0;
+		count = 0;
+	}
+};
+
+// Function prototypes for the packed board helpers
+int getTile(board state, int index);
+int getBlankIndex(board state);
+board slideTile(board state, int index);
+board reflectBoard(board state);
+board canonicalBoard(board state, bool& reflected);
+
+// Function prototypes for ranking boards
+int rankBoard(board state);
+board unrankBoard(int rank);
+
+// Number of permutations of the nine tiles, which is every possible state
+const int stateCount = 362880;
+
+// Factorials used to weight each digit of a permutation's Lehmer code
+const int factorials[] = { 40320, 5040, 720, 120, 24, 6, 2, 1, 1 };
+
+// An array representing what the goal state looks like
+constexpr int goalStateArray[] = { 1, 2, 3, 4, 5, 6, 7, 8, 0 };
+
+// A packed board representing what the goal state looks like
+board goalState = packBoard(goalStateArray);
+
+// Reflecting a board in the diagonal from the top left to the bottom right corner moves the
+// tile at each index to the index given here. The blank's goal position is on the diagonal
+const int reflectedIndex[9] = { 0, 3, 6, 1, 4, 7, 2, 5, 8 };
+
+// Number each tile is relabelled to once reflected, which is the tile the goal has where
+// the reflection puts it. A reflected and relabelled board is exactly as far from the goal
+// as the board was, and the blank's moves mirror it with up and left and right and down
+// swapped, so the two share their solutions
+const int reflectedTile[9] = { 0, 1, 4, 7, 2, 5, 8, 3, 6 };
+
+// Tables indexed by tile and position, so evaluating or updating a heuristic is a lookup
+constexpr const shapeTable<3, 3>& manhattanTable = manhattanTables<3, 3>;
+constexpr const shapeTable<3, 3>& misplacedTable = misplacedTables<3, 3>;
+
+// Heuristic tables turned around to be indexed by position and then tile, with each
+// position's entries in sixteen bytes, so the vector kernel can look up a position's value
+// for many boards with one byte shuffle. Tiles past 8 never occur and read as zero
+struct positionTable
+{
+	alignas(16) uint8_t value[9][16];
+};
+
+// Builds the position table of a heuristic from its tile table
+constexpr positionTable buildPositionTable(const shapeTable<3, 3>& table)
+{
+	positionTable positions = {};
+	for (int i = 0; i < 9; i++)
+	{
+		for (int tile = 0; tile < 9; tile++)
+		{
+			positions.value[i][tile] = (uint8_t)table.value[tile][i];
+		}
+	}
+	return positions;
+}
+
+// Position tables of the heuristics the batched kernels score
+constexpr positionTable manhattanPositions = buildPositionTable(manhattanTables<3, 3>);
+constexpr positionTable misplacedPositions = buildPositionTable(misplacedTables<3, 3>);
+
+// Number of different tile arrangements a row or column can hold
+const int lineArrangements = 729;
+
+// Table holding the linear conflict penalty of every tile arrangement of each line
+struct conflictTable
+{
+	int rows[3][lineArrangements];
+	int columns[3][lineArrangements];
+};
+
+// Builds the linear conflict penalties of every row and column for every arrangement of
+// the three tiles in it, using the conflict count of the 3x3 shape. An arrangement is
+// indexed as first * 81 + second * 9 + third
+constexpr conflictTable buildConflictTable()
+{
+	conflictTable table = {};
+	for (int arrangement = 0; arrangement < lineArrangements; arrangement++)
+	{
+		int tiles[3] = { arrangement / 81, (arrangement / 9) % 9, arrangement % 9 };
+		for (int line = 0; line < 3; line++)
+		{
+			// Lays the arrangement out as the given row and as the given column of a board
+			int rowBoard[9] = {};
+			int columnBoard[9] = {};
+			for (int i = 0; i < 3; i++)
+			{
+				rowBoard[line * 3 + i] = tiles[i];
+				columnBoard[i * 3 + line] = tiles[i];
+			}
+			table.rows[line][arrangement] = lineConflicts<3, 3>(rowBoard, line, false);
+			table.columns[line][arrangement] = lineConflicts<3, 3>(columnBoard, line, true);
+		}
+	}
+	return table;
+}
+
+// Linear conflict penalties indexed by line and tile arrangement
+constexpr conflictTable conflictPenalties = buildConflictTable();
+
+// Name and format version of the file the pattern database is stored in
+const char patternFileName[] = "8puzzle_pdb.bin";
+const uint32_t patternFileVersion = 1;
+
+// Disjoint groups of tiles used by the pattern database. Each group's table only counts
+// moves of its own tiles, so the values of the groups can be added together
+const int patternCount = 2;
+const int patternSize = 4;
+const int patternGroups[patternCount][patternSize] = { { 1, 2, 3, 4 }, { 5, 6, 7, 8 } };
+
+// Number of ways to place the tiles of a group on the board (9 * 8 * 7 * 6)
+const int patternEntries = 3024;
+
+// Header written at the front of the pattern database file, followed by one table of
+// patternEntries bytes for each group
+struct patternFileHeader
+{
+	char magic[4];
+	uint32_t version;
+	uint32_t groupCount;
+	uint32_t entryCount;
+	uint32_t groupMasks[patternCount];
+};
+
+// Read only view of the pattern database file mapped into memory
+struct mappedFile
+{
+	const uint8_t* data = nullptr;
+	size_t size = 0;
+#ifdef _WIN32
+	HANDLE file = INVALID_HANDLE_VALUE;
+	HANDLE mapping = NULL;
+#endif
+};
+
+// Mapped pattern database file, tables built in memory when the file can't be used,
+// and pointers to the table of each group in whichever of the two holds them
+mappedFile patternFile;
+vector <uint8_t> patternStorage;
+const uint8_t* patternTables[patternCount] = {};
+
+// Group each tile belongs to in the pattern database
+int tilePattern[9] = {};
+
+// Number of solvable states, which is half of all the permutations
+const int solvableCount = 181440;
+
+// Factorials used to weight each digit of the Lehmer code of the eight numbered tiles
+const int tileFactorials[] = { 5040, 720, 120, 24, 6, 2, 1, 1 };
+
+// Position in the distance oracle of each blank index on or above the diagonal. States with
+// the blank below it are looked up by their reflection, so only six blank positions are kept
+const int oracleBlankSlots[9] = { 0, 1, 2, -1, 3, 4, -1, -1, 5 };
+
+// Number of states the distance oracle keeps
+const int oracleCount = 6 * (solvableCount / 9);
+
+// Exact number of moves from every solvable state to the goal, indexed by oracleIndex.
+// Two states share each byte and only the distance modulo 16 is kept. Neighbouring states
+// are always exactly one move closer or further, so that is enough to walk downhill
+vector <uint8_t> distanceOracle;
+
+// Whether the pattern database is in memory, and the lock held while loading or releasing
+// it, so it is loaded only once even when several solvers ask for it at the same time
+atomic <bool> patternsLoaded(false);
+mutex patternsLock;
+
+// Makes sure the oracle is built only once, even when several solvers ask for it at the same time
+once_flag oracleBuilt;
+
+// Letters used to display each direction the blank can travel
+const char directionNames[] = { 'U', 'R', 'D', 'L' };
+
+// Number of legal moves of the blank for each blank index, and the moves themselves
+// ordered up, right, down, left
+constexpr const int (&moveCounts)[9] = moveTables<3, 3>.counts;
+constexpr const blankMove (&moveTable)[9][4] = moveTables<3, 3>.moves;
+
+// Every move of the blank from one blank index, worked out ahead of time as one lane per
+// move. A successor is the board with the moved tile's slot and the cached blank index
+// masked off, the tile shifted down from its slot and back up into the blank's, and the
+// new blank index added, so all the successors of a board are made with the same few steps
+struct successorLanes
+{
+	alignas(32) uint64_t tileShifts[4];
+	alignas(32) uint64_t blankShifts[4];
+	alignas(32) uint64_t keepMasks[4];
+	alignas(32) uint64_t blankBits[4];
+};
+
+// Builds the lanes of each blank index from the move table. Lanes past the legal moves
+// are left empty and their successors are never read
+constexpr array<successorLanes, 9> buildSuccessorLanes()
+{
+	array<successorLanes, 9> lanes = {};
+	for (int blankIndex = 0; blankIndex < 9; blankIndex++)
+	{
+		for (int m = 0; m < moveCounts[blankIndex]; m++)
+		{
+			int target = moveTable[blankIndex][m].target;
+			lanes[blankIndex].tileShifts[m] = 4 * target;
+			lanes[blankIndex].blankShifts[m] = 4 * blankIndex;
+			lanes[blankIndex].keepMasks[m] = ~(((board)0xF << (4 * target)) | ((board)0xF << blankShift));
+			lanes[blankIndex].blankBits[m] = (board)target << blankShift;
+		}
+	}
+	return lanes;
+}
+
+// Successor lanes indexed by blank index
+constexpr array<successorLanes, 9> successorTable = buildSuccessorLanes();
+
+// Closed set shared by the threads of the parallel breadth first search, indexed by rank.
+// A state is claimed with an atomic fetch-or on its word, so when several threads reach
+// the same state at once exactly one of them sees the bit clear and keeps it
+struct atomicBitset
+{
+	// Words holding 64 states each
+	static const int wordCount = (stateCount + 63) / 64;
+	unique_ptr <atomic <uint64_t>[]> words{ new atomic <uint64_t>[wordCount]() };
+
+	// Sets the bit for the given rank and returns true if it was already set
+	bool testAndSet(int rank)
+	{
+		uint64_t bit = (uint64_t)1 << (rank & 63);
+		return (words[rank >> 6].fetch_or(bit, memory_order_relaxed) & bit) != 0;
+	}
+
+	// Clears every bit
+	void reset()
+	{
+		for (int i = 0; i < wordCount; i++)
+		{
+			words[i].store(0, memory_order_relaxed);
+		}
+	}
+};
+
+// Smallest number of frontier nodes handed to each thread. Layers narrower than this
+// are split over fewer threads, so the shallow layers run on the calling thread alone
+const size_t minimumSlice = 2048;
+
+// Memory used by a search. Node records and frontier entries are bump allocated from
+// vectors that keep their capacity, so releasing a search is one reset instead of
+// popping every element, and no allocation happens after the first search
+struct searchArena
+{
+	// Pool holding every node created during the search. Nodes point back to their
+	// parent by index, so the solution path is only rebuilt once the goal is found
+	vector <node> nodes;
+
+	// Indexes of frontier nodes, which breadth first search reads as a queue starting at
+	// frontierHead
+	vector <int> frontier;
+	size_t frontierHead = 0;
+
+	// Nodes generated by each thread of the parallel breadth first search, waiting to be
+	// moved into the pool once the whole layer is expanded
+	vector <vector <node>> layerBuffers;
+
+	// Indexes of frontier nodes grown from the goal by the bidirectional search
+	vector <int> backwardFrontier;
+	size_t backwardHead = 0;
+
+	// Bucket queue used as the priority queue for the A* searches
+	bucketQueue openList;
+
+	// Node holding each state, indexed by rank, used by the A* searches to compare the
+	// depth of a new path with the best one found so far. An entry only counts when its
+	// stamp matches the current search, so releasing the table is one increment
+	vector <int> stateNodes;
+	vector <unsigned> stateStamps;
+	unsigned stamp = 1;
+
+	// Reserves room for every state on first use. Each state enters the pool at most
+	// once, so the pool and frontier never grow past the number of states
+	void reserve()
+	{
+		if (nodes.capacity() < (size_t)stateCount)
+		{
+			nodes.reserve(stateCount);
+			frontier.reserve(stateCount);
+			backwardFrontier.reserve(stateCount);
+			stateNodes.resize(stateCount);
+			stateStamps.resize(stateCount, 0);
+		}
+	}
+
+	// Returns the index of the node holding the state with the given rank, or -1
+	int findState(int rank) const
+	{
+		return stateStamps[rank] == stamp ? stateNodes[rank] : -1;
+	}
+
+	// Records the node holding the state with the given rank
+	void recordState(int rank, int index)
+	{
+		stateNodes[rank] = index;
+		stateStamps[rank] = stamp;
+	}
+
+	// Bump allocates a node and returns its index in the pool
+	int addNode(const node& newNode)
+	{
+		nodes.push_back(newNode);
+		return (int)nodes.size() - 1;
+	}
+
+	// Releases everything allocated during the search in one step
+	void reset()
+	{
+		nodes.clear();
+		frontier.clear();
+		frontierHead = 0;
+		backwardFrontier.clear();
+		backwardHead = 0;
+		openList.clear();
+		stamp += 1;
+	}
+};
+
+// Node sent from one parallel A* thread to the thread that owns its state
+struct message
+{
+	// The node being handed over and the next message in the queue
+	node state;
+	message* next = nullptr;
+};
+
+// Lock-free queue any thread can push messages onto and only its owner takes them from.
+// Pushing links the message in front of the head with a compare and swap, and the owner
+// takes every waiting message at once by swapping the head out for an empty list
+struct messageQueue
+{
+	// Most recently pushed message, or null when empty
+	atomic <message*> head{ nullptr };
+
+	// Adds a message to the queue from any thread
+	void push(message* item)
+	{
+		item->next = head.load(memory_order_relaxed);
+		while (head.compare_exchange_weak(item->next, item, memory_order_release, memory_order_relaxed) == false)
+		{
+		}
+	}
+
+	// Removes and returns every waiting message as a linked list
+	message* takeAll()
+	{
+		return head.exchange(nullptr, memory_order_acquire);
+	}
+
+	// Checks to see if a message is waiting
+	bool empty() const
+	{
+		return head.load(memory_order_relaxed) == nullptr;
+	}
+};
+
+// Memory owned by one parallel A* thread. Each thread keeps the states whose hash picks
+// it, so its node pool, open list and share of the closed list are never touched by
+// another thread while the search runs
+struct hdaWorker
+{
+	// Pool of the nodes this thread owns and its priority queue of their local indexes
+	vector <node> nodes;
+	bucketQueue openList;
+
+	// Nodes sent to this thread by the others
+	messageQueue inbox;
+
+	// Number of nodes this thread expanded
+	long long nodesExpanded = 0;
+};
+
+// Largest number of threads the parallel A* search will use
+const int maximumWorkers = 64;
+
+// Weights on the heuristic are rounded down to a multiple of one sixteenth, so a weighted
+// priority is still a whole number and the bucket queue can hold it
+const int weightScale = 16;
+
+// Number of entries in the transposition table of the depth limited searches. It only has
+// to catch the states reached again close together, so it stays far smaller than the state
+// space and costs the same however deep the search goes
+const int transpositionSize = 1 << 17;
+
+// Entry of the transposition table, recording the shallowest depth a state was reached at
+// during the current iteration. An entry only counts when its stamp matches the iteration
+struct transposition
+{
+	board state = 0;
+	int depth = 0;
+	unsigned stamp = 0;
+};
+
+// Number of solutions the solution cache keeps until it is told otherwise
+const size_t defaultCacheCapacity = 1 << 16;
+
+// Number of separately locked parts the solution cache is split into. Each solution goes
+// to the part its key hashes to, so threads looking up different states rarely wait
+const int cacheShards = 16;
+
+// Name and format version of the files the solution cache is saved to
+const char cacheFileMagic[4] = { '8', 'S', 'L', 'C' };
+const uint32_t cacheFileVersion = 2;
+
+// Solution kept by the cache. The key is the rank of the start state, or of its reflection
+// when that packs smaller, times 16 plus the search that solved it, and the path is stored
+// as two bits per move of the blank, first move lowest, so an entry is a few words however
+// long the path is
+struct cachedSolution
+{
+	uint64_t key;
+	uint64_t moves;
+	int32_t depth;
+	int32_t referenced;
+	int64_t nodesExpanded;
+};
+
+// One part of the solution cache. When it is full the clock hand sweeps the entries,
+// clearing the referenced mark of each one it passes and replacing the first one found
+// without it, so solutions that keep being looked up stay and the rest are evicted
+struct cacheShard
+{
+	mutex lock;
+	unordered_map <uint64_t, int> slots;
+	vector <cachedSolution> entries;
+	size_t hand = 0;
+	size_t capacity = (defaultCacheCapacity + cacheShards - 1) / cacheShards;
+};
+
+// Solution cache shared by every solver in the process
+cacheShard solutionCache[cacheShards];
+
+// Header written at the front of a cache file, followed by count solutions
+struct cacheFileHeader
+{
+	char magic[4];
+	uint32_t version;
+	uint64_t count;
+};
+
+// Everything a search writes to while it runs. Each solver owns one, so searches can run
+// side by side, and a context keeps its memory between them
+struct searchContext
+{
+	// Node pool, frontier and open list used by the search
+	searchArena arena;
+
+	// Bitset used to keep track of seen states, indexed by the rank of each state
+	bitset<stateCount> seenStates;
+
+	// Bitset marking which seen states were reached from the goal by the bidirectional search
+	bitset<stateCount> backwardStates;
+
+	// Closed set used by the breadth first search
+	atomicBitset claimedStates;
+
+	// Transposition table of the depth limited searches, indexed by a hash of the board,
+	// and the stamp of the current iteration
+	vector <transposition> transpositions;
+	unsigned transpositionStamp = 0;
+
+	// Number of threads the breadth first and parallel A* searches may use
+	size_t threadCount = 1;
+
+	// Threads of the parallel A* search, kept between searches so their memory is reused
+	vector <unique_ptr <hdaWorker>> hdaWorkers;
+	int hdaWorkerCount = 0;
+
+	// Node holding each state, indexed by rank. A node is named by its local index times the
+	// number of threads plus the thread that owns it, and only that thread writes the entry
+	vector <int> hdaStateNodes;
+
+	// Cost and name of the best goal node found, packed as cost << 32 | name so both are
+	// lowered together with one compare and swap
+	atomic <uint64_t> hdaIncumbent;
+
+	// Number of busy threads plus the number of messages sent but not yet taken in. It can
+	// only rise while it is above zero, so once it reaches zero the search is over
+	atomic <long long> hdaWork;
+
+	// Weight on the heuristic of the A* searches as a fraction. A node's priority is its depth
+	// times the denominator plus its heuristic times the numerator, which orders nodes the
+	// same as depth plus the weighted heuristic
+	int weightNumerator = 1;
+	int weightDenominator = 1;
+
+	// Whether the anytime search is running. Its nodes are not reopened within an iteration,
+	// so a node expanded in the current iteration that is reached by a shorter path waits in
+	// the inconsistent list for the next one. Stamps name the iteration each node was last
+	// expanded in or listed in, so starting an iteration clears both marks in one increment
+	bool anytime = false;
+	unsigned anytimeStamp = 0;
+	vector <unsigned> closedStamps;
+	vector <unsigned> inconsistentStamps;
+	vector <int> inconsistentNodes;
+
+	// Sets the weight of the A* searches, rounding it down to a multiple of one sixteenth that
+	// is at least one, and returns the weight actually used
+	double setWeight(double weight)
+	{
+		int numerator = weightScale;
+		if (weight > 1)
+		{
+			numerator = (int)min(weight * weightScale, (double)(100 * weightScale));
+		}
+
+		// Cancels common factors so the priorities stay as small as they can
+		int divisor = weightScale;
+		while (numerator % divisor != 0)
+		{
+			divisor /= 2;
+		}
+		weightNumerator = numerator / divisor;
+		weightDenominator = weightScale / divisor;
+
+		return (double)weightNumerator / weightDenominator;
+	}
+
+	// Priority of an A* node with the given depth and heuristic under the current weight
+	int priority(int depth, int heuristic) const
+	{
+		return depth * weightDenominator + heuristic * weightNumerator;
+	}
+
+	// Releases the arena and empties the closed sets so they can be used again
+	void clear()
+	{
+		arena.reset();
+		seenStates.reset();
+		backwardStates.reset();
+		claimedStates.reset();
+	}
+};
+
+// Function prototypes for the searches. Each one solves a start state that can be solved,
+// using only the context passed in, and returns the result without timing or displaying it
+searchResult solveBreadthFirst(searchContext& context, board start);
+void expandSlice(searchContext& context, size_t begin, size_t end, vector<node>& buffer);
+searchResult solveBidirectional(searchContext& context, board start);
+void expandLayer(searchContext& context, bool backward, int& bestLength, int& meetForward, int& meetBackward, long long& nodesExpanded);
+searchResult solveDepthLimited(searchContext& context, board start, const searchOptions& options);
+searchResult solveIterativeDeepening(searchContext& context, board start, const searchOptions& options);
+bool depthLimitedProbe(searchContext& context, vector<board>& path, int limit, int lastDirection,
+	bool useTable, long long& nodesExpanded);
+searchResult solveAStar(searchContext& context, board start, int num, const searchOptions& options);
+searchResult solveAnytimeAStar(searchContext& context, board start, int num, const searchOptions& options);
+void generateSuccessors(searchContext& context, int index, int num);
+searchResult solveIdaStar(board start, int num);
+int idaStarProbe(vector<board>& path, int heuristic, int bound, int lastDirection, int num, long long& nodesExpanded);
+searchResult solveHdaStar(searchContext& context, board start, int num);
+void hdaWorkerLoop(searchContext& context, int self, int num);
+void hdaAbsorb(searchContext& context, int self, const node& newState);
+int hdaOwner(board state, int workerCount);
+searchResult solveDistanceOracle(board start);
+int updateHeuristic(board parent, board child, int parentHeuristic, int target, int blankIndex, int num);
+int misplacedTiles(board state);
+int manhattanDistance(board state);
+int rowArrangement(board state, int row);
+int columnArrangement(board state, int column);
+int linearConflicts(board state);
+int calculateHeuristic(board state, int num);
+void scoreBoardsScalar(const board* states, size_t count, const positionTable& table, int* scores);
+#ifdef VECTOR_KERNELS
+TARGET_AVX2 void scoreBoardsAvx2(const board* states, size_t count, const positionTable& table, int* scores);
+#endif
+bool detectAvx2();
+int successorBoards(board state, board successors[4]);
+int successorsScalar(board state, board successors[4]);
+#ifdef VECTOR_KERNELS
+TARGET_AVX2 int successorsAvx2(board state, board successors[4]);
+#endif
+void recordPath(const searchArena& arena, int index, searchResult& result);
+
+// Whether the processor supports AVX2, checked once when the program starts
+const bool avx2Supported = detectAvx2();
+
+// Kernel the batched heuristics use, chosen once when the program starts by whether the
+// processor supports AVX2
+void (*const scoreBoards)(const board*, size_t, const positionTable&, int*) =
+#ifdef VECTOR_KERNELS
+	avx2Supported ? scoreBoardsAvx2 :
+#endif
+	scoreBoardsScalar;
+
+// Function prototypes for the pattern database
+void loadPatternDatabase();
+void buildPatternTable(int pattern, uint8_t* table);
+bool writePatternDatabase();
+bool mapPatternDatabase();
+bool patternHeaderValid(const patternFileHeader& header);
+void unmapPatternDatabase();
+int patternIndex(board state, int pattern);
+int patternDatabaseHeuristic(board state);
+
+// Function prototypes for the solution cache
+bool cacheable(searchAlgorithm algorithm);
+cacheShard& cacheShardOf(uint64_t key);
+bool cacheLookup(board start, uint64_t key, bool reflected, searchResult& result);
+void cacheStore(uint64_t key, bool reflected, const searchResult& result);
+uint64_t reflectMoves(uint64_t moves, int depth);
+void cacheInsert(const cachedSolution& solution);
+bool replayMoves(board start, uint64_t moves, int depth, vector<board>* path);
+
+// Function prototypes for the distance oracle
+void buildDistanceOracle();
+int solvableIndex(board state);
+int oracleIndex(board state);
+int oracleDistance(int index);
+
+// Function definitions
+Solver::Solver(size_t threadCount)
+	: context(new searchContext)
+{
+	// Records how many threads the searches may use
+	context->threadCount = max((size_t)1, threadCount);
+}
+
+Solver::~Solver() = default;
+Solver::Solver(Solver&& other) noexcept = default;
+Solver& Solver::operator=(Solver&& other) noexcept = default;
+
+searchResult Solver::solve(board start, searchAlgorithm algorithm, const searchOptions& options)
+{
+	// Rejects boards that aren't a state of the puzzle before anything reads them, since
+	// ranking or searching one would index past the end of the tables
+	searchResult result;
+	if (isValidBoard(start) == false)
+	{
+		result.valid = false;
+		result.solvable = false;
+		return result;
+	}
+
+	// Makes sure the pattern database is in memory before any search that reads it, leaving
+	// callers of the other searches without the file
+	if (algorithm == searchAlgorithm::patternDatabase || algorithm == searchAlgorithm::idaStar
+		|| algorithm == searchAlgorithm::parallelAStar)
+	{
+		loadTables();
+	}
+
+	// Times the search from start to finish
+	chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+	// Key of the start state and search in the solution cache, when it is used at all. A state
+	// and its reflection share a key, and whether the start state is the reflected one of the
+	// pair says which way round the cached moves go
+	bool useCache = options.useCache && cacheable(algorithm);
+	bool reflected = false;
+	uint64_t key = useCache ? (uint64_t)rankBoard(canonicalBoard(start, reflected)) * 16 + (uint64_t)algorithm : 0;
+
+	// Reports start states that can never reach the goal without searching
+	if (isSolvable(start) == false)
+	{
+		result.solvable = false;
+	}
+	else if (useCache && cacheLookup(start, key, reflected, result))
+	{
+		result.cached = true;
+	}
+	else
+	{
+		// Runs the search the algorithm names, passing the heuristic number to the A* searches
+		switch (algorithm)
+		{
+		case searchAlgorithm::breadthFirst:
+			result = solveBreadthFirst(*context, start);
+			break;
+		case searchAlgorithm::depthFirst:
+			result = solveDepthLimited(*context, start, options);
+			break;
+		case searchAlgorithm::misplacedTiles:
+			result = solveAStar(*context, start, 3, options);
+			break;
+		case searchAlgorithm::manhattanDistance:
+			result = solveAStar(*context, start, 4, options);
+			break;
+		case searchAlgorithm::linearConflicts:
+			result = solveAStar(*context, start, 5, options);
+			break;
+		case searchAlgorithm::patternDatabase:
+			result = solveAStar(*context, start, 6, options);
+			break;
+		case searchAlgorithm::distanceOracle:
+			result = solveDistanceOracle(start);
+			break;
+		case searchAlgorithm::idaStar:
+			result = solveIdaStar(start, 6);
+			break;
+		case searchAlgorithm::bidirectional:
+			result = solveBidirectional(*context, start);
+			break;
+		case searchAlgorithm::parallelAStar:
+			result = solveHdaStar(*context, start, 6);
+			break;
+		case searchAlgorithm::iterativeDeepening:
+			result = solveIterativeDeepening(*context, start, options);
+			break;
+		}
+
+		// Keeps the solution so the next search of this state is a lookup. Only shortest
+		// solutions are kept, so a cached solution suits every caller, weighted or not
+		if (useCache && result.solved && result.suboptimality <= 1)
+		{
+			cacheStore(key, reflected, result);
+		}
+	}
+
+	// Records how long the search took
+	result.milliseconds = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+	return result;
+}
+
+void Solver::loadTables()
+{
+	// Skips the lock once the tables are loaded, since every search calls this
+	if (patternsLoaded.load(memory_order_acquire))
+	{
+		return;
+	}
+
+	// Loads the tables unless another thread did while this one waited for the lock
+	lock_guard <mutex> guard(patternsLock);
+	if (patternsLoaded.load(memory_order_relaxed) == false)
+	{
+		loadPatternDatabase();
+		patternsLoaded.store(true, memory_order_release);
+	}
+}
+
+bool Solver::tablesSaved()
+{
+	// Reads the header of the file and checks it is the right size for the tables behind it
+	ifstream file(patternFileName, ios::binary | ios::ate);
+	if (!file || (size_t)file.tellg() != sizeof(patternFileHeader) + (size_t)patternCount * patternEntries)
+	{
+		return false;
+	}
+
+	patternFileHeader header;
+	file.seekg(0);
+	file.read((char*)&header, sizeof(header));
+	return file.good() && patternHeaderValid(header);
+}
+
+void Solver::releaseTables()
+{
+	// Unmaps the file or frees the tables built in memory, and forgets them so the next
+	// load or search maps the file again
+	lock_guard <mutex> guard(patternsLock);
+	unmapPatternDatabase();
+	patternStorage.clear();
+	patternStorage.shrink_to_fit();
+	fill(begin(patternTables), end(patternTables), nullptr);
+	patternsLoaded.store(false, memory_order_release);
+}
+
+void Solver::setCacheCapacity(size_t capacity)
+{
+	// Splits the capacity between the parts, rounding up so none is left with nothing
+	for (int i = 0; i < cacheShards; i++)
+	{
+		lock_guard <mutex> guard(solutionCache[i].lock);
+		solutionCache[i].slots.clear();
+		solutionCache[i].entries.clear();
+		solutionCache[i].hand = 0;
+		solutionCache[i].capacity = (capacity + cacheShards - 1) / cacheShards;
+	}
+}
+
+bool Solver::loadCache(const string& fileName)
+{
+	// Reads and checks the header
+	ifstream file(fileName, ios::binary);
+	cacheFileHeader header;
+	if (!file.read((char*)&header, sizeof(header)) || memcmp(header.magic, cacheFileMagic, 4) != 0
+		|| header.version != cacheFileVersion)
+	{
+		return false;
+	}
+
+	// Adds each solution whose moves really lead its start state to the goal, so a damaged
+	// file can't make the solvers report a wrong path
+	cachedSolution solution;
+	for (uint64_t i = 0; i < header.count && file.read((char*)&solution, sizeof(solution)); i++)
+	{
+		uint64_t rank = solution.key / 16;
+		if (rank < (uint64_t)stateCount && cacheable((searchAlgorithm)(solution.key % 16))
+			&& replayMoves(unrankBoard((int)rank), solution.moves, solution.depth, nullptr))
+		{
+			solution.referenced = 0;
+			cacheInsert(solution);
+		}
+	}
+
+	return true;
+}
+
+bool Solver::saveCache(const string& fileName)
+{
+	// Copies the solutions out of each part, holding only that part's lock at a time
+	vector <cachedSolution> solutions;
+	for (int i = 0; i < cacheShards; i++)
+	{
+		lock_guard <mutex> guard(solutionCache[i].lock);
+		solutions.insert(solutions.end(), solutionCache[i].entries.begin(), solutionCache[i].entries.end());
+	}
+
+	// Writes the header followed by every solution
+	cacheFileHeader header;
+	memcpy(header.magic, cacheFileMagic, 4);
+	header.version = cacheFileVersion;
+	header.count = solutions.size();
+
+	ofstream file(fileName, ios::binary | ios::trunc);
+	file.write((const char*)&header, sizeof(header));
+	file.write((const char*)solutions.data(), solutions.size() * sizeof(cachedSolution));
+
+	return file.good();
+}
+
+searchResult solveBreadthFirst(searchContext& context, board start)
+{
+	// Result of the search and the arena it allocates from
+	searchResult result;
+	searchArena& arena = context.arena;
+
+	// Creates a node to store the first state
+	node state;
+
+	// Fills in the data for the node
+	state.stateBoard = start;
+
+	// Puts the node in the arena and its index in the queue
+	arena.reserve();
+	arena.frontier.push_back(arena.addNode(state));
+
+	// Marks the current state as seen
+	context.claimedStates.testAndSet(rankBoard(start));
+
+	// Index of the node holding the goal state, -1 until it is found
+	int goalIndex = start == goalState ? arena.frontier[0] : -1;
+
+	// Expands one whole layer of the queue at a time until the goal state is found
+	while (goalIndex == -1)
+	{
+		// The current layer runs from the head of the queue to its end
+		size_t layerStart = arena.frontierHead;
+		size_t layerEnd = arena.frontier.size();
+
+		// Checks to see if the the queue is empty
+		if (layerStart == layerEnd)
+		{
+			//If so, then no solution was found and every node in the queue was expanded
+			result.nodesExpanded = (long long)layerEnd;
+			context.clear();
+			return result;
+		}
+
+		// Splits the layer into one contiguous slice per thread
+		size_t width = layerEnd - layerStart;
+		size_t sliceCount = min(context.threadCount, max((size_t)1, width / minimumSlice));
+		if (arena.layerBuffers.size() < sliceCount)
+		{
+			arena.layerBuffers.resize(sliceCount);
+		}
+
+		// Expands every slice but the first on its own thread, and the first on this one.
+		// The threads only read the pool, which never reallocates since it is reserved
+		vector <thread> workers;
+		for (size_t t = 1; t < sliceCount; t++)
+		{
+			workers.emplace_back(expandSlice, ref(context), layerStart + width * t / sliceCount,
+				layerStart + width * (t + 1) / sliceCount, ref(arena.layerBuffers[t]));
+		}
+		expandSlice(context, layerStart, layerStart + width / sliceCount, arena.layerBuffers[0]);
+		for (size_t t = 0; t < workers.size(); t++)
+		{
+			workers[t].join();
+		}
+
+		// Records the layer as expanded
+		result.depth = arena.nodes[arena.frontier[layerStart]].depth;
+		arena.frontierHead = layerEnd;
+
+		// Moves each thread's nodes into the pool in slice order to form the next layer
+		for (size_t t = 0; t < sliceCount; t++)
+		{
+			for (size_t i = 0; i < arena.layerBuffers[t].size(); i++)
+			{
+				int newIndex = arena.addNode(arena.layerBuffers[t][i]);
+				arena.frontier.push_back(newIndex);
+
+				// Checks to see if the new node has the goal state
+				if (goalIndex == -1 && arena.nodes[newIndex].stateBoard == goalState)
+				{
+					goalIndex = newIndex;
+
+					// Every node queued ahead of the goal would have been expanded before it
+					result.nodesExpanded = (long long)arena.frontier.size() - 1;
+				}
+			}
+			arena.layerBuffers[t].clear();
+		}
+	}
+
+	// Records the solution path rebuilt from the goal node
+	result.solved = true;
+	result.depth = arena.nodes[goalIndex].depth;
+	recordPath(arena, goalIndex, result);
+
+	// Releases the arena and empties the closed set so they can be used again
+	context.clear();
+	return result;
+}
+
+void expandSlice(searchContext& context, size_t begin, size_t end, vector<node>& buffer)
+{
+	// Expands each node in the slice of the queue
+	for (size_t i = begin; i < end; i++)
+	{
+		// Index and copy of the node being expanded
+		int index = context.arena.frontier[i];
+		node state = context.arena.nodes[index];
+
+		// Reads the index value of the 0 (blank piece) cached in the board and makes every
+		// successor at once, in the same order as the moves in the move table
+		int blankIndex = getBlankIndex(state.stateBoard);
+		board successors[4];
+		successorBoards(state.stateBoard, successors);
+
+		// Loops through the legal moves of the blank listed in the move table
+		for (int m = 0; m < moveCounts[blankIndex]; m++)
+		{
+			board successor = successors[m];
+
+			// Claims the state, skipping it if this or another thread already has
+			if (context.claimedStates.testAndSet(rankBoard(successor)) == false)
+			{
+				// Creates a node to store the state
+				node newState;
+
+				// Fills in the data for the node, linking it back to its parent
+				newState.stateBoard = successor;
+				newState.depth = state.depth + 1;
+				newState.parent = index;
+				newState.direction = moveTable[blankIndex][m].direction;
+
+				// Keeps the node in this thread's buffer until the layer is merged
+				buffer.push_back(newState);
+			}
+		}
+	}
+}
+
+searchResult solveBidirectional(searchContext& context, board start)
+{
+	// Result of the search and the arena it allocates from
+	searchResult result;
+	searchArena& arena = context.arena;
+
+	// Length of the shortest path found where the two searches meet, and the node on each
+	// side of the meeting. A length of -1 means the searches haven't met yet
+	int bestLength = -1;
+	int meetForward = -1;
+	int meetBackward = -1;
+
+	// Creates nodes to store the first state and the goal state
+	node state;
+	node goal;
+
+	// Fills in the data for the nodes
+	state.stateBoard = start;
+	goal.stateBoard = goalState;
+
+	// Puts the first state in the forward queue and the goal state in the backward queue
+	arena.reserve();
+	arena.frontier.push_back(arena.addNode(state));
+	arena.recordState(rankBoard(start), arena.frontier[0]);
+	context.seenStates.set(rankBoard(start));
+
+	// Checks to see if the initial state is already the goal state
+	if (start == goalState)
+	{
+		bestLength = 0;
+		meetForward = arena.frontier[0];
+	}
+	else
+	{
+		arena.backwardFrontier.push_back(arena.addNode(goal));
+		arena.recordState(rankBoard(goalState), arena.backwardFrontier[0]);
+		context.seenStates.set(rankBoard(goalState));
+		context.backwardStates.set(rankBoard(goalState));
+	}
+
+	// Expands whole layers until the searches meet. The meeting found while finishing a
+	// layer is the shortest one, so the search stops only at the end of a layer
+	while (bestLength == -1)
+	{
+		// Number of nodes waiting in the current layer on each side
+		size_t forwardWidth = arena.frontier.size() - arena.frontierHead;
+		size_t backwardWidth = arena.backwardFrontier.size() - arena.backwardHead;
+
+		// Checks to see if either side ran out of states
+		if (forwardWidth == 0 || backwardWidth == 0)
+		{
+			//If so, then no solution was found since the searches never met
+			context.clear();
+			return result;
+		}
+
+		// Always expands the side with the smaller layer
+		expandLayer(context, backwardWidth < forwardWidth, bestLength, meetForward, meetBackward,
+			result.nodesExpanded);
+	}
+
+	// Records the path from the initial state to the meeting, then walks the backward
+	// node's parent links to the goal, which already lists those states in order
+	result.solved = true;
+	result.depth = bestLength;
+	recordPath(arena, meetForward, result);
+	for (int index = meetBackward; index != -1; index = arena.nodes[index].parent)
+	{
+		result.path.push_back(arena.nodes[index].stateBoard);
+	}
+
+	// Releases the arena and empties the closed set so they can be used again
+	context.clear();
+	return result;
+}
+
+void expandLayer(searchContext& context, bool backward, int& bestLength, int& meetForward, int& meetBackward, long long& nodesExpanded)
+{
+	// Arena the search allocates from
+	searchArena& arena = context.arena;
+
+	// Queue being expanded, and where its current layer ends
+	vector <int>& frontier = backward ? arena.backwardFrontier : arena.frontier;
+	size_t& head = backward ? arena.backwardHead : arena.frontierHead;
+	size_t layerEnd = frontier.size();
+
+	// Expands every node in the current layer
+	for (; head < layerEnd; head++)
+	{
+		// Copies the node being expanded
+		int index = frontier[head];
+		node state = arena.nodes[index];
+
+		// Reads the index value of the 0 (blank piece) cached in the board and makes every
+		// successor at once, in the same order as the moves in the move table
+		int blankIndex = getBlankIndex(state.stateBoard);
+		board successors[4];
+		successorBoards(state.stateBoard, successors);
+
+		// Loops through the legal moves of the blank listed in the move table
+		for (int m = 0; m < moveCounts[blankIndex]; m++)
+		{
+			board successor = successors[m];
+
+			// Ranks the state once so it can be both checked and recorded
+			int stateRank = rankBoard(successor);
+
+			// Checks to see if that state has been seen
+			if (context.seenStates.test(stateRank) == false)
+			{
+				// Creates a node to store the state
+				node newState;
+
+				// Fills in the data for the node, linking it back to its parent
+				newState.stateBoard = successor;
+				newState.depth = state.depth + 1;
+				newState.parent = index;
+				newState.direction = moveTable[blankIndex][m].direction;
+
+				// Allocates the new node in the arena and pushes it to this side's queue
+				int newIndex = arena.addNode(newState);
+				frontier.push_back(newIndex);
+
+				// Records the state in the closed set along with the side that reached it
+				arena.recordState(stateRank, newIndex);
+				context.seenStates.set(stateRank);
+				if (backward)
+				{
+					context.backwardStates.set(stateRank);
+				}
+			}
+			// Checks to see if the state was reached by the other side
+			else if (context.backwardStates.test(stateRank) != backward)
+			{
+				// Node on the other side holding the state, and the path length through it
+				int other = arena.findState(stateRank);
+				int length = state.depth + 1 + arena.nodes[other].depth;
+
+				// Keeps the shortest meeting found in this layer
+				if (bestLength == -1 || length < bestLength)
+				{
+					bestLength = length;
+					meetForward = backward ? other : index;
+					meetBackward = backward ? index : other;
+				}
+			}
+		}
+
+		// Records that a node was expanded
+		nodesExpanded += 1;
+	}
+}
+
+searchResult solveDepthLimited(searchContext& context, board start, const searchOptions& options)
+{
+	// Result of the search, whose path holds the states of the branch being explored
+	searchResult result;
+	result.path.push_back(start);
+
+	// Starts a new iteration of the transposition table
+	if (options.transpositionTable && context.transpositions.empty())
+	{
+		context.transpositions.resize(transpositionSize);
+	}
+	context.transpositionStamp += 1;
+
+	// Explores every branch up to the depth limit, stopping at the first that reaches the goal
+	result.solved = depthLimitedProbe(context, result.path, options.depthLimit, -1,
+		options.transpositionTable, result.nodesExpanded);
+
+	// Records the depth of the path found, or the limit that was reached
+	result.depth = result.solved ? (int)result.path.size() - 1 : max(0, options.depthLimit);
+	return result;
+}
+
+searchResult solveIterativeDeepening(searchContext& context, board start, const searchOptions& options)
+{
+	// Result of the search and the limit of each iteration
+	searchResult result;
+	searchOptions iteration = options;
+
+	// Runs a depth limited search with limits of 0, 1, 2 and so on. The first one to reach
+	// the goal finds the shortest path, since every shallower limit found none
+	for (iteration.depthLimit = 0; iteration.depthLimit <= options.depthLimit; iteration.depthLimit++)
+	{
+		long long nodesExpanded = result.nodesExpanded;
+		result = solveDepthLimited(context, start, iteration);
+		result.nodesExpanded += nodesExpanded;
+
+		if (result.solved)
+		{
+			break;
+		}
+	}
+
+	return result;
+}
+
+bool depthLimitedProbe(searchContext& context, vector<board>& path, int limit, int lastDirection,
+	bool useTable, long long& nodesExpanded)
+{
+	// State at the end of the path and the number of moves taken to reach it
+	board state = path.back();
+	int depth = (int)path.size() - 1;
+
+	// Returns true to show the goal was found, leaving the solution in the path
+	if (state == goalState)
+	{
+		return true;
+	}
+
+	// Stops going deeper once the limit is reached, which a negative limit already is
+	if (depth >= limit)
+	{
+		return false;
+	}
+
+	// Skips the state if this iteration already reached it at the same depth or shallower,
+	// since everything below it was explored then with at least as many moves to spare
+	if (useTable)
+	{
+		transposition& entry = context.transpositions[(state * 0x9E3779B97F4A7C15ull) >> 47];
+		if (entry.stamp == context.transpositionStamp && entry.state == state && entry.depth <= depth)
+		{
+			return false;
+		}
+		entry.state = state;
+		entry.depth = depth;
+		entry.stamp = context.transpositionStamp;
+	}
+
+	// Records that a node was expanded
+	nodesExpanded += 1;
+
+	int blankIndex = getBlankIndex(state);
+
+	// Loops through the legal moves of the blank listed in the move table
+	for (int m = 0; m < moveCounts[blankIndex]; m++)
+	{
+		// Skips the move that would slide the last tile straight back
+		int direction = moveTable[blankIndex][m].direction;
+		if (lastDirection != -1 && direction == (lastDirection + 2) % 4)
+		{
+			continue;
+		}
+
+		// Extends the path by the move and explores below it
+		path.push_back(slideTile(state, moveTable[blankIndex][m].target));
+		if (depthLimitedProbe(context, path, limit, direction, useTable, nodesExpanded))
+		{
+			return true;
+		}
+		path.pop_back();
+	}
+
+	return false;
+}
+
+searchResult solveIdaStar(board start, int num)
+{
+	// Result of the search
+	searchResult result;
+
+	// States on the path currently being probed, which is the only memory the search uses
+	vector<board>& path = result.path;
+	path.push_back(start);
+
+	// The first bound is the heuristic of the initial state
+	int heuristic = calculateHeuristic(start, num);
+	int bound = heuristic;
+
+	// Probes deeper and deeper, raising the bound to the smallest cost that went over it,
+	// until a probe reaches the goal
+	int probe = idaStarProbe(path, heuristic, bound, -1, num, result.nodesExpanded);
+	while (probe != -1)
+	{
+		bound = probe;
+		probe = idaStarProbe(path, heuristic, bound, -1, num, result.nodesExpanded);
+	}
+
+	// The path the final probe took is the solution
+	result.solved = true;
+	result.depth = (int)path.size() - 1;
+	return result;
+}
+
+searchResult solveHdaStar(searchContext& context, board start, int num)
+{
+	// Result of the search
+	searchResult result;
+
+	// Sets up one worker per thread the context allows, reusing the memory of earlier searches
+	context.hdaWorkerCount = (int)min((size_t)maximumWorkers, context.threadCount);
+	while ((int)context.hdaWorkers.size() < context.hdaWorkerCount)
+	{
+		context.hdaWorkers.emplace_back(new hdaWorker);
+	}
+	for (int t = 0; t < context.hdaWorkerCount; t++)
+	{
+		context.hdaWorkers[t]->nodes.clear();
+		context.hdaWorkers[t]->openList.clear();
+		context.hdaWorkers[t]->nodesExpanded = 0;
+	}
+	context.hdaStateNodes.assign(stateCount, -1);
+	context.hdaIncumbent.store(numeric_limits<uint64_t>::max());
+
+	// Creates a node to store the first state
+	node state;
+
+	// Fills in the data for the node
+	state.stateBoard = start;
+	state.heuristic = calculateHeuristic(start, num);
+
+	// Hands the first state to the thread that owns it, then starts every thread busy
+	hdaAbsorb(context, hdaOwner(start, context.hdaWorkerCount), state);
+	context.hdaWork.store(context.hdaWorkerCount);
+	vector <thread> workers;
+	for (int t = 1; t < context.hdaWorkerCount; t++)
+	{
+		workers.emplace_back(hdaWorkerLoop, ref(context), t, num);
+	}
+	hdaWorkerLoop(context, 0, num);
+	for (size_t t = 0; t < workers.size(); t++)
+	{
+		workers[t].join();
+	}
+
+	// Adds up the nodes every thread expanded
+	for (int t = 0; t < context.hdaWorkerCount; t++)
+	{
+		result.nodesExpanded += context.hdaWorkers[t]->nodesExpanded;
+	}
+
+	// Checks to see if a goal node was found
+	uint64_t incumbent = context.hdaIncumbent.load();
+	if (incumbent == numeric_limits<uint64_t>::max())
+	{
+		return result;
+	}
+
+	// Walks the parent links from the goal back to the initial state across the threads
+	result.solved = true;
+	result.depth = (int)(incumbent >> 32);
+	vector<board>& path = result.path;
+	for (int name = (int)(incumbent & 0xFFFFFFFF); name != -1; )
+	{
+		const node& pathNode = context.hdaWorkers[name % context.hdaWorkerCount]->nodes[name / context.hdaWorkerCount];
+		path.push_back(pathNode.stateBoard);
+		name = pathNode.parent;
+	}
+
+	// Puts the states in order from the initial state to the goal
+	reverse(path.begin(), path.end());
+	return result;
+}
+
+void hdaWorkerLoop(searchContext& context, int self, int num)
+{
+	// Memory owned by this thread
+	hdaWorker& worker = *context.hdaWorkers[self];
+
+	while (true)
+	{
+		// Takes in the nodes other threads sent, which stop counting as work once held
+		for (message* item = worker.inbox.takeAll(); item != nullptr; )
+		{
+			message* next = item->next;
+			hdaAbsorb(context, self, item->state);
+			delete item;
+			item = next;
+			context.hdaWork.fetch_sub(1);
+		}
+
+		// Cost of the best goal found so far
+		long long bestCost = (long long)(context.hdaIncumbent.load() >> 32);
+
+		// Checks to see if this thread has a node that could lead to a cheaper goal
+		if (worker.openList.empty() == false)
+		{
+			const node& next = worker.nodes[worker.openList.top()];
+			if (next.depth + next.heuristic < bestCost)
+			{
+				// Index of the node being expanded
+				int index = worker.openList.pop();
+				node state = worker.nodes[index];
+				int name = index * context.hdaWorkerCount + self;
+
+				// A goal popped here is the cheapest this thread can find, so it lowers the
+				// best cost, leaving the other threads to finish anything cheaper
+				if (state.stateBoard == goalState)
+				{
+					uint64_t found = (uint64_t)state.depth << 32 | (uint32_t)name;
+					uint64_t current = context.hdaIncumbent.load();
+					while (found < current && context.hdaIncumbent.compare_exchange_weak(current, found) == false)
+					{
+					}
+					continue;
+				}
+
+				// Records that a node was expanded
+				worker.nodesExpanded += 1;
+
+				// Reads the index value of the 0 (blank piece) cached in the board
+				int blankIndex = getBlankIndex(state.stateBoard);
+
+				// Loops through the legal moves of the blank listed in the move table
+				for (int m = 0; m < moveCounts[blankIndex]; m++)
+				{
+					// Index of the tile that slides into the blank
+					int target = moveTable[blankIndex][m].target;
+
+					// Creates a node to store the successor, linking it back to its parent
+					node newState;
+					newState.stateBoard = slideTile(state.stateBoard, target);
+					newState.depth = state.depth + 1;
+					newState.parent = name;
+					newState.direction = moveTable[blankIndex][m].direction;
+					newState.heuristic = updateHeuristic(state.stateBoard, newState.stateBoard,
+						state.heuristic, target, blankIndex, num);
+
+					// Keeps the successor if this thread owns it, otherwise sends it on
+					int owner = hdaOwner(newState.stateBoard, context.hdaWorkerCount);
+					if (owner == self)
+					{
+						hdaAbsorb(context, self, newState);
+					}
+					else
+					{
+						message* item = new message;
+						item->state = newState;
+						context.hdaWork.fetch_add(1);
+						context.hdaWorkers[owner]->inbox.push(item);
+					}
+				}
+				continue;
+			}
+		}
+
+		// Nothing left that could beat the best goal, so this thread goes idle until a
+		// message arrives or every thread is idle with no messages left to take in
+		context.hdaWork.fetch_sub(1);
+		while (true)
+		{
+			if (worker.inbox.empty() == false)
+			{
+				context.hdaWork.fetch_add(1);
+				break;
+			}
+			if (context.hdaWork.load() == 0)
+			{
+				return;
+			}
+			this_thread::yield();
+		}
+	}
+}
+
+void hdaAbsorb(searchContext& context, int self, const node& newState)
+{
+	// Memory owned by this thread
+	hdaWorker& worker = *context.hdaWorkers[self];
+
+	// Drops nodes that can't lead to a goal cheaper than the best one found
+	if (newState.depth + newState.heuristic >= (long long)(context.hdaIncumbent.load() >> 32))
+	{
+		return;
+	}
+
+	// Looks up the node already holding this state
+	int stateRank = rankBoard(newState.stateBoard);
+	int existing = context.hdaStateNodes[stateRank];
+
+	if (existing == -1)
+	{
+		// Adds the node to this thread's pool and open list
+		worker.nodes.push_back(newState);
+		int index = (int)worker.nodes.size() - 1;
+		worker.openList.push(newState.depth + newState.heuristic, newState.depth, index);
+		context.hdaStateNodes[stateRank] = index * context.hdaWorkerCount + self;
+	}
+	else if (newState.depth < worker.nodes[existing / context.hdaWorkerCount].depth)
+	{
+		// A shorter path was found, so the node is relinked and its key lowered, or it is
+		// reopened if it was already expanded
+		int index = existing / context.hdaWorkerCount;
+		worker.nodes[index] = newState;
+		if (worker.openList.contains(index))
+		{
+			worker.openList.decreaseKey(newState.depth + newState.heuristic, newState.depth, index);
+		}
+		else
+		{
+			worker.openList.push(newState.depth + newState.heuristic, newState.depth, index);
+		}
+	}
+}
+
+int hdaOwner(board state, int workerCount)
+{
+	// Mixes every bit of the board into the top bits and picks a thread from them
+	return (int)(((state * 0x9E3779B97F4A7C15ull) >> 32) % (uint64_t)workerCount);
+}
+
+int idaStarProbe(vector<board>& path, int heuristic, int bound, int lastDirection, int num, long long& nodesExpanded)
+{
+	// State at the end of the path and the number of moves taken to reach it
+	board state = path.back();
+	int depth = (int)path.size() - 1;
+
+	// Stops going deeper once the cost goes over the bound, returning it so the next
+	// bound can be the smallest cost that went over
+	if (depth + heuristic > bound)
+	{
+		return depth + heuristic;
+	}
+
+	// Returns -1 to show the goal was found, leaving the solution in the path
+	if (state == goalState)
+	{
+		return -1;
+	}
+
+	// Records that a node was expanded
+	nodesExpanded += 1;
+
+	// Smallest cost found over the bound below this state
+	int nextBound = numeric_limits<int>::max();
+
+	int blankIndex = getBlankIndex(state);
+	for (int m = 0; m < moveCounts[blankIndex]; m++)
+	{
+		// Skips the move that would slide the blank straight back where it came from
+		int direction = moveTable[blankIndex][m].direction;
+		if (lastDirection != -1 && direction == (lastDirection + 2) % 4)
+		{
+			continue;
+		}
+
+		// Slides the tile into the blank and probes below the new state
+		int target = moveTable[blankIndex][m].target;
+		board nextState = slideTile(state, target);
+		path.push_back(nextState);
+
+		int result = idaStarProbe(path, updateHeuristic(state, nextState, heuristic, target, blankIndex, num),
+			bound, direction, num, nodesExpanded);
+		if (result == -1)
+		{
+			return -1;
+		}
+
+		// Takes the state back off the path and keeps the smallest cost over the bound
+		path.pop_back();
+		if (result < nextBound)
+		{
+			nextBound = result;
+		}
+	}
+
+	return nextBound;
+}
+
+searchResult solveDistanceOracle(board start)
+{
+	// Result of the walk, which counts table lookups as its expanded nodes
+	searchResult result;
+
+	// State the walk has reached
+	board stateBoard = start;
+
+	// Solves every state once, the first time the oracle is used
+	call_once(oracleBuilt, buildDistanceOracle);
+
+	// Records the first time the oracle is read
+	result.nodesExpanded = 1;
+
+	// Distance left to the goal, modulo 16
+	int distance = oracleDistance(oracleIndex(stateBoard));
+
+	// States visited on the way to the goal
+	vector<board>& path = result.path;
+	path.push_back(stateBoard);
+
+	// Moves to a neighbour one move closer to the goal until the goal is reached. No state
+	// is more than 31 moves away, so a longer walk means the state can't be solved
+	while (stateBoard != goalState && (int)path.size() <= 31)
+	{
+		// Neighbour found to be one move closer, if there is one
+		board closerBoard = stateBoard;
+
+		int blankIndex = getBlankIndex(stateBoard);
+		for (int m = 0; m < moveCounts[blankIndex] && closerBoard == stateBoard; m++)
+		{
+			board nextBoard = slideTile(stateBoard, moveTable[blankIndex][m].target);
+			result.nodesExpanded += 1;
+
+			if (oracleDistance(oracleIndex(nextBoard)) == (distance + 15) % 16)
+			{
+				closerBoard = nextBoard;
+			}
+		}
+
+		// Stops if no neighbour is closer, since the state has no solution
+		if (closerBoard == stateBoard)
+		{
+			break;
+		}
+
+		stateBoard = closerBoard;
+		distance = (distance + 15) % 16;
+		path.push_back(stateBoard);
+	}
+
+	// Records the depth of the walk, which is the solution if it ended at the goal
+	result.solved = stateBoard == goalState;
+	result.depth = (int)path.size() - 1;
+	return result;
+}
+
+searchResult solveAStar(searchContext& context, board start, int num, const searchOptions& options)
+{
+	// Hands the anytime search off, since it runs weighted searches one after another
+	if (options.anytime)
+	{
+		return solveAnytimeAStar(context, start, num, options);
+	}
+
+	// Result of the search and the arena it allocates from
+	searchResult result;
+	searchArena& arena = context.arena;
+
+	// Weights the heuristic, which bounds how much longer than the shortest the solution can be
+	result.suboptimality = context.setWeight(options.weight);
+
+	// Creates a node to store the first state
+	node state;
+
+	// Fills in the data for the node
+	state.stateBoard = start;
+	// Calculates the heuristic chosen by the search
+	state.heuristic = calculateHeuristic(state.stateBoard, num);
+
+	// Puts the node in the arena and its index in the priority queue
+	arena.reserve();
+	int rootIndex = arena.addNode(state);
+	arena.openList.push(context.priority(state.depth, state.heuristic), state.depth, rootIndex);
+
+	// Records the node holding the current state
+	arena.recordState(rankBoard(start), rootIndex);
+
+	// Loops search until the next node in the priority queue has the goal state
+	while (arena.openList.empty() || arena.nodes[arena.openList.top()].stateBoard != goalState)
+	{
+		// Checks to see if the the priority queue is empty
+		if (arena.openList.empty())
+		{
+			//If so, then no solution was found
+			context.clear();
+			return result;
+		}
+
+		// Index of the node being expanded
+		int index = arena.openList.pop();
+
+		// Records the depth reached in case a solution isn't found
+		result.depth = arena.nodes[index].depth;
+
+		// Passes that node to a function to generate successor states
+		generateSuccessors(context, index, num);
+
+		// Records that a node was expanded
+		result.nodesExpanded += 1;
+	}
+
+	// Records the solution path rebuilt from the goal node. A weighted search can reach a
+	// node by a shorter path after expanding it, so the depth is taken from the path
+	result.solved = true;
+	recordPath(arena, arena.openList.top(), result);
+	result.depth = (int)result.path.size() - 1;
+
+	// Releases the arena and empties the closed set so they can be used again
+	context.clear();
+	return result;
+}
+
+searchResult solveAnytimeAStar(searchContext& context, board start, int num, const searchOptions& options)
+{
+	// Result of the search and the arena it allocates from
+	searchResult result;
+	searchArena& arena = context.arena;
+
+	// Times the search so it can stop improving once its time is up
+	chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+	// Weight of the first iteration and how much each later one takes off it
+	double weight = context.setWeight(options.weight);
+	double weightStep = max(1.0 / weightScale, options.weightStep);
+
+	// Creates a node to store the first state
+	node state;
+	state.stateBoard = start;
+	state.heuristic = calculateHeuristic(state.stateBoard, num);
+
+	// Puts the node in the arena and its index in the priority queue
+	arena.reserve();
+	int rootIndex = arena.addNode(state);
+	arena.openList.push(context.priority(state.depth, state.heuristic), state.depth, rootIndex);
+	arena.recordState(rankBoard(start), rootIndex);
+
+	// Starts the first iteration with no node expanded or listed as inconsistent yet
+	if (context.closedStamps.size() < (size_t)stateCount)
+	{
+		context.closedStamps.resize(stateCount, 0);
+		context.inconsistentStamps.resize(stateCount, 0);
+	}
+	context.anytime = true;
+	context.anytimeStamp += 1;
+	context.inconsistentNodes.clear();
+
+	// Rank of the goal state, whose node holds the best solution found so far
+	int goalRank = rankBoard(goalState);
+
+	while (true)
+	{
+		// Expands nodes until none in the priority queue could lead to a better solution
+		// under this weight than the one already found
+		while (!arena.openList.empty())
+		{
+			int goalIndex = arena.findState(goalRank);
+			if (goalIndex != -1 && context.priority(arena.nodes[goalIndex].depth, 0) <= arena.openList.topCost())
+			{
+				break;
+			}
+
+			int index = arena.openList.pop();
+			context.closedStamps[index] = context.anytimeStamp;
+			generateSuccessors(context, index, num);
+			result.nodesExpanded += 1;
+		}
+
+		// Stops if the goal was never reached, which only happens when it can't be
+		int goalIndex = arena.findState(goalRank);
+		if (goalIndex == -1)
+		{
+			break;
+		}
+
+		// Keeps the solution, which is never longer than the last one since the goal's
+		// node only ever moves to shorter paths. Nodes waiting in the inconsistent list
+		// still hold the depths of their old paths, and so may the nodes below them, so
+		// the depth is taken from the path the parent links give
+		result.solved = true;
+		result.path.clear();
+		recordPath(arena, goalIndex, result);
+		result.depth = (int)result.path.size() - 1;
+
+		// The shortest solution can't be shorter than the lowest depth plus heuristic of any
+		// node waiting to be expanded, which gives a bound often well below the weight
+		int lowestCost = result.depth;
+		vector <int> waiting;
+		arena.openList.drain(waiting);
+		waiting.insert(waiting.end(), context.inconsistentNodes.begin(), context.inconsistentNodes.end());
+		for (size_t i = 0; i < waiting.size(); i++)
+		{
+			lowestCost = min(lowestCost, arena.nodes[waiting[i]].depth + arena.nodes[waiting[i]].heuristic);
+		}
+		result.suboptimality = lowestCost > 0 ? min(weight, (double)result.depth / lowestCost) : 1;
+
+		// Stops once the solution is known to be the shortest or the time is up
+		double elapsed = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+		if (result.suboptimality <= 1 || (options.timeLimit > 0 && elapsed >= options.timeLimit))
+		{
+			break;
+		}
+
+		// Lowers the weight and starts the next iteration with every waiting node queued
+		// under it, keeping the nodes and paths found so far
+		weight = context.setWeight(weight - weightStep);
+		context.anytimeStamp += 1;
+		context.inconsistentNodes.clear();
+		for (size_t i = 0; i < waiting.size(); i++)
+		{
+			const node& waitingNode = arena.nodes[waiting[i]];
+			arena.openList.push(context.priority(waitingNode.depth, waitingNode.heuristic), waitingNode.depth, waiting[i]);
+		}
+	}
+
+	// Releases the arena and empties the closed set so they can be used again
+	context.anytime = false;
+	context.clear();
+	return result;
+}
+
+void generateSuccessors(searchContext& context, int index, int num)
+{
+	// Arena the search allocates from
+	searchArena& arena = context.arena;
+
+	// Copies the node being expanded
+	node state = arena.nodes[index];
+
+	// Reads the index value of the 0 (blank piece) cached in the board
+	int blankIndex = getBlankIndex(state.stateBoard);
+
+	// Loops through the legal moves of the blank listed in the move table
+	for (int m = 0; m < moveCounts[blankIndex]; m++)
+	{
+		// Index of the tile that slides into the blank
+		int target = moveTable[blankIndex][m].target;
+
+		// Slides the neighbouring tile into the blank
+		board successor = slideTile(state.stateBoard, target);
+
+		// Ranks the state once so it can be both checked and recorded
+		int stateRank = rankBoard(successor);
+
+		// Depth of the state when reached through this node
+		int newDepth = state.depth + 1;
+
+		// Looks up the node already holding that state so the depth of this path can be
+		// compared with the best one so far
+		int existing = arena.findState(stateRank);
+
+		if (existing == -1)
+		{
+			// Creates a node to store the state
+			node newState;
+
+			// Fills in the data for the node, linking it back to its parent
+			newState.stateBoard = successor;
+			newState.depth = newDepth;
+			newState.parent = index;
+			newState.direction = moveTable[blankIndex][m].direction;
+			// Updates the heuristic for the one tile that moved
+			newState.heuristic = updateHeuristic(state.stateBoard, successor, state.heuristic,
+				target, blankIndex, num);
+
+			// Allocates the new node in the arena and pushes it to the priority queue
+			int newIndex = arena.addNode(newState);
+			arena.openList.push(context.priority(newState.depth, newState.heuristic), newState.depth, newIndex);
+
+			// Records the node holding the state
+			arena.recordState(stateRank, newIndex);
+		}
+		else if (newDepth < arena.nodes[existing].depth)
+		{
+			// A shorter path to a known state was found, so its node is relinked to this
+			// parent. The state and so its heuristic are unchanged
+			node& betterState = arena.nodes[existing];
+			betterState.depth = newDepth;
+			betterState.parent = index;
+			betterState.direction = moveTable[blankIndex][m].direction;
+
+			// Lowers its key if it is still waiting in the priority queue, otherwise it
+			// was already expanded and is reopened so its successors are improved too.
+			// The anytime search leaves nodes expanded in this iteration for the next one
+			if (arena.openList.contains(existing))
+			{
+				arena.openList.decreaseKey(context.priority(newDepth, betterState.heuristic), newDepth, existing);
+			}
+			else if (context.anytime && context.closedStamps[existing] == context.anytimeStamp)
+			{
+				if (context.inconsistentStamps[existing] != context.anytimeStamp)
+				{
+					context.inconsistentStamps[existing] = context.anytimeStamp;
+					context.inconsistentNodes.push_back(existing);
+				}
+			}
+			else
+			{
+				arena.openList.push(context.priority(newDepth, betterState.heuristic), newDepth, existing);
+			}
+		}
+	}
+}
+
+int updateHeuristic(board parent, board child, int parentHeuristic, int target, int blankIndex, int num)
+{
+	// Value of the tile that slid from the target index into the blank
+	int tile = getTile(parent, target);
+
+	// Depending on the type of search, will update either the number of misplaced tiles
+	// or the Manhattan distance for the heuristic. Only the moved tile changes, so the
+	// parent's heuristic is adjusted by that tile's old and new table entries
+	if (num == 3)
+	{
+		return parentHeuristic - misplacedTable.value[tile][target]
+			+ misplacedTable.value[tile][blankIndex];
+	}
+	else if (num == 4)
+	{
+		return parentHeuristic - manhattanTable.value[tile][target]
+			+ manhattanTable.value[tile][blankIndex];
+	}
+	// Linear conflicts also update the Manhattan distance, then re-evaluate the two
+	// lines the tile left and entered. A move along a row keeps the order of the
+	// tiles in that row, so only the two columns change, and the other way around
+	else if (num == 5)
+	{
+		int heuristic = parentHeuristic - manhattanTable.value[tile][target]
+			+ manhattanTable.value[tile][blankIndex];
+
+		if (target / 3 == blankIndex / 3)
+		{
+			heuristic += conflictPenalties.columns[target % 3][columnArrangement(child, target % 3)]
+				- conflictPenalties.columns[target % 3][columnArrangement(parent, target % 3)]
+				+ conflictPenalties.columns[blankIndex % 3][columnArrangement(child, blankIndex % 3)]
+				- conflictPenalties.columns[blankIndex % 3][columnArrangement(parent, blankIndex % 3)];
+		}
+		else
+		{
+			heuristic += conflictPenalties.rows[target / 3][rowArrangement(child, target / 3)]
+				- conflictPenalties.rows[target / 3][rowArrangement(parent, target / 3)]
+				+ conflictPenalties.rows[blankIndex / 3][rowArrangement(child, blankIndex / 3)]
+				- conflictPenalties.rows[blankIndex / 3][rowArrangement(parent, blankIndex / 3)];
+		}
+
+		return heuristic;
+	}
+	// The pattern database only changes for the group holding the moved tile, so
+	// that group's table is looked up again for the old and new boards
+	else if (num == 6)
+	{
+		int pattern = tilePattern[tile];
+		return parentHeuristic
+			- patternTables[pattern][patternIndex(parent, pattern)]
+			+ patternTables[pattern][patternIndex(child, pattern)];
+	}
+
+	// The uninformed searches have no heuristic
+	return 0;
+}
+
+int misplacedTiles(board state)
+{
+	// Adds up the misplaced table entry of each tile
+	int count = 0;
+	for (int i = 0; i < 9; i++)
+	{
+		count += misplacedTable.value[getTile(state, i)][i];
+	}
+
+	return count;
+}
+
+int manhattanDistance(board state)
+{
+	// Adds up the row and column distance of each tile from its goal position
+	int distance = 0;
+	for (int i = 0; i < 9; i++)
+	{
+		distance += manhattanTable.value[getTile(state, i)][i];
+	}
+
+	return distance;
+}
+
+int rowArrangement(board state, int row)
+{
+	// Index of the tiles in the row, used to look up its linear conflicts
+	return getTile(state, 3 * row) * 81 + getTile(state, 3 * row + 1) * 9 + getTile(state, 3 * row + 2);
+}
+
+int columnArrangement(board state, int column)
+{
+	// Index of the tiles in the column, used to look up its linear conflicts
+	return getTile(state, column) * 81 + getTile(state, column + 3) * 9 + getTile(state, column + 6);
+}
+
+int linearConflicts(board state)
+{
+	// Starts from the Manhattan distance and adds the penalty of every row and column
+	int distance = manhattanDistance(state);
+	for (int line = 0; line < 3; line++)
+	{
+		distance += conflictPenalties.rows[line][rowArrangement(state, line)];
+		distance += conflictPenalties.columns[line][columnArrangement(state, line)];
+	}
+
+	return distance;
+}
+
+int calculateHeuristic(board state, int num)
+{
+	// Calculates the heuristic used by the search number from scratch
+	if (num == 3)
+	{
+		return misplacedTiles(state);
+	}
+	else if (num == 4)
+	{
+		return manhattanDistance(state);
+	}
+	else if (num == 5)
+	{
+		return linearConflicts(state);
+	}
+	else if (num == 6)
+	{
+		return patternDatabaseHeuristic(state);
+	}
+
+	return 0;
+}
+
+void misplacedTileCounts(const board* states, size_t count, int* counts)
+{
+	scoreBoards(states, count, misplacedPositions, counts);
+}
+
+void manhattanDistances(const board* states, size_t count, int* distances)
+{
+	scoreBoards(states, count, manhattanPositions, distances);
+}
+
+void scoreBoardsScalar(const board* states, size_t count, const positionTable& table, int* scores)
+{
+	// Adds up the table entry of the tile at each position of every board
+	for (size_t b = 0; b < count; b++)
+	{
+		int score = 0;
+		for (int i = 0; i < 9; i++)
+		{
+			score += table.value[i][getTile(states[b], i)];
+		}
+		scores[b] = score;
+	}
+}
+
+#ifdef VECTOR_KERNELS
+TARGET_AVX2 void scoreBoardsAvx2(const board* states, size_t count, const positionTable& table, int* scores)
+{
+	// Each position's sixteen table bytes, copied into both halves of a register since the
+	// byte shuffle looks up within each half on its own
+	__m256i positionValues[9];
+	for (int i = 0; i < 9; i++)
+	{
+		positionValues[i] = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)table.value[i]));
+	}
+	const __m256i tileMask = _mm256_set1_epi64x(0xF);
+
+	// Scores eight boards at a time, four to a register. Shifting a board down to each
+	// position leaves that position's tile in the lowest byte of the board's lane and zero
+	// in the rest, and zero looks up the blank's entry, which is zero in both tables, so
+	// the shuffle leaves each lane holding just that tile's value
+	size_t b = 0;
+	for (; b + 8 <= count; b += 8)
+	{
+		__m256i low = _mm256_loadu_si256((const __m256i*)(states + b));
+		__m256i high = _mm256_loadu_si256((const __m256i*)(states + b + 4));
+		__m256i lowSums = _mm256_setzero_si256();
+		__m256i highSums = _mm256_setzero_si256();
+		for (int i = 0; i < 9; i++)
+		{
+			__m128i shift = _mm_cvtsi32_si128(4 * i);
+			__m256i lowTiles = _mm256_and_si256(_mm256_srl_epi64(low, shift), tileMask);
+			__m256i highTiles = _mm256_and_si256(_mm256_srl_epi64(high, shift), tileMask);
+			lowSums = _mm256_add_epi64(lowSums, _mm256_shuffle_epi8(positionValues[i], lowTiles));
+			highSums = _mm256_add_epi64(highSums, _mm256_shuffle_epi8(positionValues[i], highTiles));
+		}
+
+		// Gathers the low half of each lane's sum, where the whole sum fits, into eight scores
+		const __m256i lowHalves = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+		__m256i lowScores = _mm256_permutevar8x32_epi32(lowSums, lowHalves);
+		__m256i highScores = _mm256_permutevar8x32_epi32(highSums, lowHalves);
+		_mm256_storeu_si256((__m256i*)(scores + b), _mm256_permute2x128_si256(lowScores, highScores, 0x20));
+	}
+
+	// Scores the boards left over one at a time
+	scoreBoardsScalar(states + b, count - b, table, scores + b);
+}
+#endif
+
+bool detectAvx2()
+{
+#if defined(VECTOR_KERNELS) && defined(_MSC_VER)
+	// Checks that the processor has AVX2 and that the system saves the wide registers
+	int info[4];
+	__cpuid(info, 1);
+	bool savesRegisters = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 6) == 6;
+	__cpuidex(info, 7, 0);
+	return savesRegisters && (info[1] & (1 << 5)) != 0;
+#elif defined(VECTOR_KERNELS)
+	// Runs before main, so the processor details may not have been read yet
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2");
+#else
+	return false;
+#endif
+}
+
+int successorBoards(board state, board successors[4])
+{
+	// Uses the vector version when the processor has it. Both give the same successors
+#ifdef VECTOR_KERNELS
+	if (avx2Supported)
+	{
+		return successorsAvx2(state, successors);
+	}
+#endif
+	return successorsScalar(state, successors);
+}
+
+int successorsScalar(board state, board successors[4])
+{
+	// Makes each successor from its lane of the table
+	int blankIndex = getBlankIndex(state);
+	const successorLanes& lanes = successorTable[blankIndex];
+	for (int m = 0; m < moveCounts[blankIndex]; m++)
+	{
+		board tile = (state >> lanes.tileShifts[m]) & 0xF;
+		successors[m] = (state & lanes.keepMasks[m]) | (tile << lanes.blankShifts[m]) | lanes.blankBits[m];
+	}
+
+	return moveCounts[blankIndex];
+}
+
+#ifdef VECTOR_KERNELS
+TARGET_AVX2 int successorsAvx2(board state, board successors[4])
+{
+	// Copies the board into all four lanes and makes every successor with one variable
+	// shift down, one variable shift up and a mask, each lane using its own move
+	int blankIndex = getBlankIndex(state);
+	const successorLanes& lanes = successorTable[blankIndex];
+	__m256i boards = _mm256_set1_epi64x((long long)state);
+	__m256i tiles = _mm256_and_si256(_mm256_srlv_epi64(boards, _mm256_load_si256((const __m256i*)lanes.tileShifts)),
+		_mm256_set1_epi64x(0xF));
+	__m256i kept = _mm256_and_si256(boards, _mm256_load_si256((const __m256i*)lanes.keepMasks));
+	__m256i placed = _mm256_sllv_epi64(tiles, _mm256_load_si256((const __m256i*)lanes.blankShifts));
+	__m256i children = _mm256_or_si256(_mm256_or_si256(kept, placed),
+		_mm256_load_si256((const __m256i*)lanes.blankBits));
+	_mm256_storeu_si256((__m256i*)successors, children);
+
+	return moveCounts[blankIndex];
+}
+#endif
+
+void recordPath(const searchArena& arena, int index, searchResult& result)
+{
+	// Walks the parent links from the goal back to the initial state
+	size_t first = result.path.size();
+	while (index != -1)
+	{
+		result.path.push_back(arena.nodes[index].stateBoard);
+		index = arena.nodes[index].parent;
+	}
+
+	// Puts the states in order from the initial state to the goal
+	reverse(result.path.begin() + first, result.path.end());
+}
+
+string pathMoves(const vector<board>& path)
+{
+	// Letters of the moves made by the blank, one per step of the path
+	string moves;
+	for (size_t i = 1; i < path.size(); i++)
+	{
+		// The blank index moves by one across a row or by three down a column
+		int step = getBlankIndex(path[i]) - getBlankIndex(path[i - 1]);
+		moves += directionNames[step == -3 ? 0 : step == 1 ? 1 : step == 3 ? 2 : 3];
+	}
+
+	return moves;
+}
+
+board packBoard(const int state[9])
+{
+	// Board being built
+	board packed = 0;
+
+	// Places each tile into its 4 bit slot and records where the blank is
+	for (int i = 0; i < 9; i++)
+	{
+		packed |= (board)state[i] << (4 * i);
+
+		if (state[i] == 0)
+		{
+			packed |= (board)i << blankShift;
+		}
+	}
+
+	return packed;
+}
+
+int getTile(board state, int index)
+{
+	// Shifts the tile's slot down and masks off the rest of the board
+	return (int)((state >> (4 * index)) & 0xF);
+}
+
+int getBlankIndex(board state)
+{
+	// Reads the cached blank index from the top of the board
+	return (int)((state >> blankShift) & 0xF);
+}
+
+board slideTile(board state, int index)
+{
+	// Index of the blank and value of the tile that will slide into it
+	int blankIndex = getBlankIndex(state);
+	board tile = (state >> (4 * index)) & 0xF;
+
+	// Empties the tile's old slot, which becomes the blank
+	state &= ~((board)0xF << (4 * index));
+
+	// Places the tile where the blank was
+	state |= tile << (4 * blankIndex);
+
+	// Updates the cached blank index
+	state &= ~((board)0xF << blankShift);
+	state |= (board)index << blankShift;
+
+	return state;
+}
+
+board reflectBoard(board state)
+{
+	// Board being built
+	board reflected = 0;
+
+	// Moves each tile across the diagonal and relabels it, the blank included
+	for (int i = 0; i < 9; i++)
+	{
+		reflected |= (board)reflectedTile[getTile(state, i)] << (4 * reflectedIndex[i]);
+	}
+
+	// Moves the cached blank index across the diagonal too
+	reflected |= (board)reflectedIndex[getBlankIndex(state)] << blankShift;
+
+	return reflected;
+}
+
+board canonicalBoard(board state, bool& reflected)
+{
+	// Represents a board and its reflection by whichever packs to the smaller number
+	board reflection = reflectBoard(state);
+	reflected = reflection < state;
+
+	return reflected ? reflection : state;
+}
+
+string boardToString(board state)
+{
+	// String of the nine tiles in order, used when displaying states
+	string stateStr;
+	for (int i = 0; i < 9; i++)
+	{
+		stateStr += (char)('0' + getTile(state, i));
+	}
+
+	return stateStr;
+}
+
+bool isValidBoard(board state)
+{
+	// Nothing may be set above the cached blank index
+	if ((state >> blankShift) > 8)
+	{
+		return false;
+	}
+
+	// Every tile from 0 to 8 has to appear once, with the blank where the index says
+	int usedTiles = 0;
+	for (int i = 0; i < 9; i++)
+	{
+		int tile = getTile(state, i);
+		if (tile > 8 || (usedTiles & (1 << tile)) != 0)
+		{
+			return false;
+		}
+		usedTiles |= 1 << tile;
+	}
+	return getTile(state, getBlankIndex(state)) == 0;
+}
+
+bool isSolvable(board state)
+{
+	// Boards that aren't a state of the puzzle can never reach the goal
+	if (isValidBoard(state) == false)
+	{
+		return false;
+	}
+
+	// Counts the inversions, the pairs of numbered tiles that are in the opposite order
+	// to the goal. Each tile's count is the number of smaller tiles still to come, which
+	// is the number of smaller tiles not placed yet, so each tile needs one bit count
+	int inversions = 0;
+	int usedTiles = 0;
+	for (int i = 0; i < 9; i++)
+	{
+		int tile = getTile(state, i);
+		if (tile != 0)
+		{
+			inversions += (tile - 1) - (int)bitset<9>(usedTiles & ((1 << tile) - 2)).count();
+			usedTiles |= 1 << tile;
+		}
+	}
+
+	// On a board three tiles wide every move keeps the parity of the inversions, and the
+	// goal has none, so only states with an even number of inversions can be solved
+	return inversions % 2 == 0;
+}
+
+int rankBoard(board state)
+{
+	// Rank being built from the Lehmer code of the permutation
+	int rank = 0;
+
+	// Bit mask of the tiles that have already been placed
+	int usedTiles = 0;
+
+	for (int i = 0; i < 9; i++)
+	{
+		int tile = getTile(state, i);
+
+		// The Lehmer digit is the number of smaller tiles that have not been placed yet
+		int digit = tile - (int)bitset<9>(usedTiles & ((1 << tile) - 1)).count();
+
+		rank += digit * factorials[i];
+		usedTiles |= 1 << tile;
+	}
+
+	return rank;
+}
+
+board unrankBoard(int rank)
+{
+	// Tiles in the order they are picked from the permutation
+	int state[9];
+
+	// Bit mask of the tiles that have already been placed
+	int usedTiles = 0;
+
+	for (int i = 0; i < 9; i++)
+	{
+		// The Lehmer digit says how many unused tiles to skip over
+		int digit = rank / factorials[i];
+		rank %= factorials[i];
+
+		// Finds the unused tile with exactly that many smaller unused tiles
+		int tile = 0;
+		while ((usedTiles & (1 << tile)) != 0 || digit > 0)
+		{
+			if ((usedTiles & (1 << tile)) == 0)
+			{
+				digit -= 1;
+			}
+			tile += 1;
+		}
+
+		state[i] = tile;
+		usedTiles |= 1 << tile;
+	}
+
+	return packBoard(state);
+}
+
+void loadPatternDatabase()
+{
+	// Records which group each tile belongs to
+	for (int pattern = 0; pattern < patternCount; pattern++)
+	{
+		for (int i = 0; i < patternSize; i++)
+		{
+			tilePattern[patternGroups[pattern][i]] = pattern;
+		}
+	}
+
+	// Uses the file from an earlier run when there is one that matches these groups
+	if (mapPatternDatabase())
+	{
+		return;
+	}
+
+	// Otherwise builds the tables and writes them out for next time
+	patternStorage.assign((size_t)patternCount * patternEntries, 0);
+	for (int pattern = 0; pattern < patternCount; pattern++)
+	{
+		buildPatternTable(pattern, &patternStorage[(size_t)pattern * patternEntries]);
+		patternTables[pattern] = &patternStorage[(size_t)pattern * patternEntries];
+	}
+
+	// Switches over to the mapped file once it is written, keeping the built tables
+	// if the file can't be written or mapped
+	if (writePatternDatabase() && mapPatternDatabase())
+	{
+		patternStorage.clear();
+		patternStorage.shrink_to_fit();
+	}
+}
+
+void buildPatternTable(int pattern, uint8_t* table)
+{
+	// Abstract state of the group: where each of its tiles is and where the blank is
+	struct abstractState
+	{
+		int positions[patternSize];
+		int blankIndex;
+	};
+
+	// Fewest moves of the group's tiles needed for each abstract state, indexed by the
+	// placement of the tiles times 9 plus the blank index. 255 marks unreached states
+	vector <uint8_t> distances((size_t)patternEntries * 9, 255);
+
+	// Starts from the goal, where every tile and the blank are in their goal positions
+	abstractState start;
+	for (int i = 0; i < patternSize; i++)
+	{
+		for (int j = 0; j < 9; j++)
+		{
+			if (goalStateArray[j] == patternGroups[pattern][i])
+			{
+				start.positions[i] = j;
+			}
+			else if (goalStateArray[j] == 0)
+			{
+				start.blankIndex = j;
+			}
+		}
+	}
+
+	// Index of an abstract state in the distance array
+	auto stateIndex = [](const abstractState& state)
+	{
+		// Ranks the tile positions like a partial Lehmer code
+		int rank = 0;
+		int usedPositions = 0;
+		for (int i = 0; i < patternSize; i++)
+		{
+			int digit = state.positions[i] - (int)bitset<9>(usedPositions & ((1 << state.positions[i]) - 1)).count();
+			rank = rank * (9 - i) + digit;
+			usedPositions |= 1 << state.positions[i];
+		}
+		return rank * 9 + state.blankIndex;
+	};
+
+	// Breadth first search backwards from the goal where sliding one of the group's tiles
+	// costs a move and sliding any other tile is free. Free moves go on the front of the
+	// deque and counted moves on the back, so states come off in order of distance
+	deque <abstractState> frontier;
+	distances[stateIndex(start)] = 0;
+	frontier.push_back(start);
+
+	while (!frontier.empty())
+	{
+		abstractState state = frontier.front();
+		frontier.pop_front();
+		int distance = distances[stateIndex(state)];
+
+		for (int m = 0; m < moveCounts[state.blankIndex]; m++)
+		{
+			// Slides whatever is next to the blank, checking if it is one of the group's tiles
+			abstractState next = state;
+			int target = moveTable[state.blankIndex][m].target;
+			int cost = 0;
+			for (int i = 0; i < patternSize; i++)
+			{
+				if (next.positions[i] == target)
+				{
+					next.positions[i] = state.blankIndex;
+					cost = 1;
+				}
+			}
+			next.blankIndex = target;
+
+			// Records the state if this is the shortest way found to it
+			int nextIndex = stateIndex(next);
+			if (distance + cost < distances[nextIndex])
+			{
+				distances[nextIndex] = (uint8_t)(distance + cost);
+				if (cost == 0)
+				{
+					frontier.push_front(next);
+				}
+				else
+				{
+					frontier.push_back(next);
+				}
+			}
+		}
+	}
+
+	// The table keeps the smallest distance over every position of the blank
+	for (int i = 0; i < patternEntries; i++)
+	{
+		table[i] = 255;
+		for (int blankIndex = 0; blankIndex < 9; blankIndex++)
+		{
+			if (distances[(size_t)i * 9 + blankIndex] < table[i])
+			{
+				table[i] = distances[(size_t)i * 9 + blankIndex];
+			}
+		}
+	}
+}
+
+bool writePatternDatabase()
+{
+	// Fills in the header describing the tables
+	patternFileHeader header;
+	memcpy(header.magic, "8PDB", 4);
+	header.version = patternFileVersion;
+	header.groupCount = patternCount;
+	header.entryCount = patternEntries;
+	for (int pattern = 0; pattern < patternCount; pattern++)
+	{
+		header.groupMasks[pattern] = 0;
+		for (int i = 0; i < patternSize; i++)
+		{
+			header.groupMasks[pattern] |= 1 << patternGroups[pattern][i];
+		}
+	}
+
+	// Writes the header followed by each table to a file of this process's own. Another
+	// process may have the finished file mapped, and truncating a mapped file crashes it
+	// the next time it reads the mapping
+#ifdef _WIN32
+	string tempName = string(patternFileName) + "." + to_string(GetCurrentProcessId()) + ".tmp";
+#else
+	string tempName = string(patternFileName) + "." + to_string(getpid()) + ".tmp";
+#endif
+	ofstream file(tempName, ios::binary | ios::trunc);
+	file.write((const char*)&header, sizeof(header));
+	for (int pattern = 0; pattern < patternCount; pattern++)
+	{
+		file.write((const char*)patternTables[pattern], patternEntries);
+	}
+	file.close();
+
+	// Swaps the finished file in by name, so readers see either the old file or the new
+	// one and never one part written
+#ifdef _WIN32
+	bool written = file.good() && MoveFileExA(tempName.c_str(), patternFileName, MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+	bool written = file.good() && rename(tempName.c_str(), patternFileName) == 0;
+#endif
+	if (!written)
+	{
+		remove(tempName.c_str());
+	}
+	return written;
+}
+
+bool mapPatternDatabase()
+{
+	// Size the file has to be to hold the header and every table
+	size_t expectedSize = sizeof(patternFileHeader) + (size_t)patternCount * patternEntries;
+	mappedFile mapped;
+
+#ifdef _WIN32
+	// Opens the file and maps a read only view of it
+	mapped.file = CreateFileA(patternFileName, GENERIC_READ, FILE_SHARE_READ, NULL,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (mapped.file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(mapped.file, &fileSize) || (size_t)fileSize.QuadPart != expectedSize)
+	{
+		CloseHandle(mapped.file);
+		return false;
+	}
+
+	mapped.mapping = CreateFileMappingA(mapped.file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (mapped.mapping == NULL)
+	{
+		CloseHandle(mapped.file);
+		return false;
+	}
+
+	mapped.data = (const uint8_t*)MapViewOfFile(mapped.mapping, FILE_MAP_READ, 0, 0, 0);
+	if (mapped.data == nullptr)
+	{
+		CloseHandle(mapped.mapping);
+		CloseHandle(mapped.file);
+		return false;
+	}
+#else
+	// Opens the file and maps a read only view of it
+	int file = open(patternFileName, O_RDONLY);
+	if (file < 0)
+	{
+		return false;
+	}
+
+	struct stat fileInfo;
+	if (fstat(file, &fileInfo) != 0 || (size_t)fileInfo.st_size != expectedSize)
+	{
+		close(file);
+		return false;
+	}
+
+	void* data = mmap(nullptr, expectedSize, PROT_READ, MAP_PRIVATE, file, 0);
+	close(file);
+	if (data == MAP_FAILED)
+	{
+		return false;
+	}
+	mapped.data = (const uint8_t*)data;
+#endif
+	mapped.size = expectedSize;
+
+	// Checks that the file was written by this version for the same tile groups
+	patternFileHeader header;
+	memcpy(&header, mapped.data, sizeof(header));
+	bool valid = patternHeaderValid(header);
+
+	// Releases any earlier mapping and points the tables into this one
+	unmapPatternDatabase();
+	patternFile = mapped;
+	if (!valid)
+	{
+		unmapPatternDatabase();
+		return false;
+	}
+
+	for (int pattern = 0; pattern < patternCount; pattern++)
+	{
+		patternTables[pattern] = patternFile.data + sizeof(patternFileHeader) + (size_t)pattern * patternEntries;
+	}
+
+	return true;
+}
+
+bool patternHeaderValid(const patternFileHeader& header)
+{
+	// Checks the file was written by this version with the same number and size of tables
+	bool valid = memcmp(header.magic, "8PDB", 4) == 0 && header.version == patternFileVersion
+		&& header.groupCount == (uint32_t)patternCount && header.entryCount == (uint32_t)patternEntries;
+
+	// Checks each table is for the same group of tiles
+	for (int pattern = 0; valid && pattern < patternCount; pattern++)
+	{
+		uint32_t mask = 0;
+		for (int i = 0; i < patternSize; i++)
+		{
+			mask |= 1 << patternGroups[pattern][i];
+		}
+		valid = header.groupMasks[pattern] == mask;
+	}
+
+	return valid;
+}
+
+void unmapPatternDatabase()
+{
+	// Nothing to do if no file is mapped
+	if (patternFile.data == nullptr)
+	{
+		return;
+	}
+
+#ifdef _WIN32
+	UnmapViewOfFile(patternFile.data);
+	CloseHandle(patternFile.mapping);
+	CloseHandle(patternFile.file);
+#else
+	munmap((void*)patternFile.data, patternFile.size);
+#endif
+	patternFile = mappedFile();
+}
+
+int patternIndex(board state, int pattern)
+{
+	// Finds where each tile is on the board
+	int positions[9];
+	for (int i = 0; i < 9; i++)
+	{
+		positions[getTile(state, i)] = i;
+	}
+
+	// Ranks the positions of the group's tiles like a partial Lehmer code
+	int rank = 0;
+	int usedPositions = 0;
+	for (int i = 0; i < patternSize; i++)
+	{
+		int position = positions[patternGroups[pattern][i]];
+		int digit = position - (int)bitset<9>(usedPositions & ((1 << position) - 1)).count();
+		rank = rank * (9 - i) + digit;
+		usedPositions |= 1 << position;
+	}
+
+	return rank;
+}
+
+int patternDatabaseHeuristic(board state)
+{
+	// Adds together the table value of every group, since the groups share no tiles
+	int distance = 0;
+	for (int pattern = 0; pattern < patternCount; pattern++)
+	{
+		distance += patternTables[pattern][patternIndex(state, pattern)];
+	}
+
+	return distance;
+}
+
+void buildDistanceOracle()
+{
+	// Two distances are kept in each byte
+	distanceOracle.assign(oracleCount / 2, 0);
+
+	// Bitset used to keep track of the states that have been reached
+	vector <bool> reached(solvableCount, false);
+
+	// Breadth first search backwards from the goal. Every move can be undone, so the
+	// depth a state is reached at is the number of moves it needs to reach the goal
+	vector <board> layer;
+	layer.push_back(goalState);
+	reached[solvableIndex(goalState)] = true;
+
+	for (int distance = 0; !layer.empty(); distance++)
+	{
+		vector <board> nextLayer;
+		for (size_t i = 0; i < layer.size(); i++)
+		{
+			// Stores the distance in the low or high half of the state's byte. A state and
+			// its reflection share a place and a distance, so storing it twice is harmless
+			int index = oracleIndex(layer[i]);
+			distanceOracle[index / 2] |= (uint8_t)((distance % 16) << (4 * (index % 2)));
+
+			// Queues every neighbour that hasn't been reached yet
+			int blankIndex = getBlankIndex(layer[i]);
+			for (int m = 0; m < moveCounts[blankIndex]; m++)
+			{
+				board nextBoard = slideTile(layer[i], moveTable[blankIndex][m].target);
+				int nextIndex = solvableIndex(nextBoard);
+				if (!reached[nextIndex])
+				{
+					reached[nextIndex] = true;
+					nextLayer.push_back(nextBoard);
+				}
+			}
+		}
+		layer.swap(nextLayer);
+	}
+}
+
+int solvableIndex(board state)
+{
+	// Ranks the eight numbered tiles in board order, skipping the blank
+	int rank = 0;
+	int usedTiles = 0;
+	int digitIndex = 0;
+	for (int i = 0; i < 9; i++)
+	{
+		int tile = getTile(state, i);
+		if (tile != 0)
+		{
+			int digit = (tile - 1) - (int)bitset<9>(usedTiles & ((1 << tile) - 1)).count();
+			rank += digit * tileFactorials[digitIndex];
+			usedTiles |= 1 << tile;
+			digitIndex += 1;
+		}
+	}
+
+	// Swapping the last two tiles flips whether a state can be solved, and the two orders
+	// differ only in the last digit of the rank, so dropping it leaves a unique index for
+	// each solvable state with the same blank position
+	return getBlankIndex(state) * (solvableCount / 9) + rank / 2;
+}
+
+int oracleIndex(board state)
+{
+	// Looks states with the blank below the diagonal up by their reflection
+	int blankIndex = getBlankIndex(state);
+	if (oracleBlankSlots[blankIndex] < 0)
+	{
+		state = reflectBoard(state);
+		blankIndex = getBlankIndex(state);
+	}
+
+	// Uses the index of the solvable state within its blank position, under the slot the
+	// blank position has in the oracle
+	return oracleBlankSlots[blankIndex] * (solvableCount / 9) + solvableIndex(state) % (solvableCount / 9);
+}
+
+int oracleDistance(int index)
+{
+	// Reads the low or high half of the state's byte
+	return (distanceOracle[index / 2] >> (4 * (index % 2))) & 0xF;
+}
+
+bool cacheable(searchAlgorithm algorithm)
+{
+	// The depth limited searches find different paths under different settings, so only
+	// the searches whose solution depends on nothing but the start state are cached
+	return algorithm >= searchAlgorithm::breadthFirst && algorithm < searchAlgorithm::iterativeDeepening
+		&& algorithm != searchAlgorithm::depthFirst;
+}
+
+cacheShard& cacheShardOf(uint64_t key)
+{
+	// Mixes the key so neighbouring ranks spread over every part
+	return solutionCache[((key * 0x9E3779B97F4A7C15) >> 32) % cacheShards];
+}
+
+bool cacheLookup(board start, uint64_t key, bool reflected, searchResult& result)
+{
+	// Copies the solution out while holding the lock, marking it as recently used
+	cachedSolution solution;
+	{
+		cacheShard& shard = cacheShardOf(key);
+		lock_guard <mutex> guard(shard.lock);
+		unordered_map <uint64_t, int>::iterator slot = shard.slots.find(key);
+		if (slot == shard.slots.end())
+		{
+			return false;
+		}
+
+		shard.entries[slot->second].referenced = 1;
+		solution = shard.entries[slot->second];
+	}
+
+	// Rebuilds the path from the moves once the lock is released, mirroring them when they
+	// were stored for the start state's reflection
+	uint64_t moves = reflected ? reflectMoves(solution.moves, solution.depth) : solution.moves;
+	result.solved = true;
+	result.depth = solution.depth;
+	result.nodesExpanded = solution.nodesExpanded;
+	result.path.reserve(solution.depth + 1);
+	replayMoves(start, moves, solution.depth, &result.path);
+
+	return true;
+}
+
+void cacheStore(uint64_t key, bool reflected, const searchResult& result)
+{
+	// Only paths of up to 32 moves fit two bits per move in one word, which every solution
+	// of the cached searches does
+	if (result.path.size() > 33)
+	{
+		return;
+	}
+
+	// Packs the moves of the blank along the path, first move lowest
+	cachedSolution solution;
+	solution.key = key;
+	solution.moves = 0;
+	solution.depth = result.depth;
+	solution.referenced = 1;
+	solution.nodesExpanded = result.nodesExpanded;
+	for (size_t i = 1; i < result.path.size(); i++)
+	{
+		// The blank index moves by one across a row or by three down a column
+		int step = getBlankIndex(result.path[i]) - getBlankIndex(result.path[i - 1]);
+		uint64_t direction = step == -3 ? 0 : step == 1 ? 1 : step == 3 ? 2 : 3;
+		solution.moves |= direction << (2 * (i - 1));
+	}
+
+	// Stores the moves of the state the key ranks, which is the reflection of this one
+	// when it was reflected
+	if (reflected)
+	{
+		solution.moves = reflectMoves(solution.moves, solution.depth);
+	}
+
+	cacheInsert(solution);
+}
+
+void cacheInsert(const cachedSolution& solution)
+{
+	cacheShard& shard = cacheShardOf(solution.key);
+	lock_guard <mutex> guard(shard.lock);
+
+	// Nothing is kept when the cache is turned off
+	if (shard.capacity == 0)
+	{
+		return;
+	}
+
+	// Replaces the solution already kept for the key, which another solver may have stored
+	// while this one was searching
+	unordered_map <uint64_t, int>::iterator slot = shard.slots.find(solution.key);
+	if (slot != shard.slots.end())
+	{
+		shard.entries[slot->second] = solution;
+		return;
+	}
+
+	// Appends the solution while there is room
+	if (shard.entries.size() < shard.capacity)
+	{
+		shard.slots[solution.key] = (int)shard.entries.size();
+		shard.entries.push_back(solution);
+		return;
+	}
+
+	// Moves the hand past every solution used since it last came by, giving each a second
+	// chance, and evicts the first one that wasn't
+	while (shard.entries[shard.hand].referenced != 0)
+	{
+		shard.entries[shard.hand].referenced = 0;
+		shard.hand = (shard.hand + 1) % shard.entries.size();
+	}
+
+	shard.slots.erase(shard.entries[shard.hand].key);
+	shard.slots[solution.key] = (int)shard.hand;
+	shard.entries[shard.hand] = solution;
+	shard.hand = (shard.hand + 1) % shard.entries.size();
+}
+
+uint64_t reflectMoves(uint64_t moves, int depth)
+{
+	// Directions are numbered up, right, down, left, so flipping both bits of each move
+	// swaps up with left and right with down, which is how reflection mirrors them
+	uint64_t movesMask = depth >= 32 ? ~(uint64_t)0 : ((uint64_t)1 << (2 * depth)) - 1;
+	return moves ^ movesMask;
+}
+
+bool replayMoves(board start, uint64_t moves, int depth, vector<board>* path)
+{
+	// Paths longer than a word holds can't have been stored
+	if (depth < 0 || depth > 32)
+	{
+		return false;
+	}
+
+	board state = start;
+	if (path != nullptr)
+	{
+		path->push_back(state);
+	}
+
+	// Slides the blank in each stored direction, failing if it would leave the board
+	for (int i = 0; i < depth; i++)
+	{
+		int direction = (int)((moves >> (2 * i)) & 3);
+		int blankIndex = getBlankIndex(state);
+		int target = -1;
+		for (int m = 0; m < moveCounts[blankIndex]; m++)
+		{
+			if (moveTable[blankIndex][m].direction == direction)
+			{
+				target = moveTable[blankIndex][m].target;
+			}
+		}
+
+		if (target < 0)
+		{
+			return false;
+		}
+
+		state = slideTile(state, target);
+		if (path != nullptr)
+		{
+			path->push_back(state);
+		}
+	}
+
+	return state == goalState;
+}
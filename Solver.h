@@ -0,0 +1,162 @@
+/**************************************************************************************************
+* 8 Slider Puzzle Solver
+* Searches for solutions to the 8 slider puzzle. Every Solver owns the memory its searches use,
+* so separate solvers can search at the same time on separate threads, and a solver keeps that
+* memory between searches so later ones don't allocate. The menu program and its batch mode are
+* both clients of this interface.
+**************************************************************************************************/
+
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include<cstdint>
+#include<memory>
+#include<string>
+#include<vector>
+
+// Packed representation of an environment state. Each of the nine tiles takes 4 bits
+// (index 0 in the lowest bits) and the index of the blank is cached in bits 36-39,
+// so a whole state fits in one register and is copied and compared as a single word
+typedef uint64_t board;
+
+// Searches a solver can run, numbered the same as the menu choices that run them
+enum class searchAlgorithm
+{
+	breadthFirst = 3,
+	depthFirst,
+	misplacedTiles,
+	manhattanDistance,
+	linearConflicts,
+	patternDatabase,
+	distanceOracle,
+	idaStar,
+	bidirectional,
+	parallelAStar,
+	iterativeDeepening
+};
+
+// Settings for the searches that have any
+struct searchOptions
+{
+	// Deepest path the depth limited and iterative deepening searches explore. No state is
+	// more than 31 moves from the goal, so the default always finds a solution. Negative
+	// limits act as a limit of zero
+	int depthLimit = 31;
+
+	// Whether those searches skip states already reached at the same depth or shallower,
+	// using a small table of recent states
+	bool transpositionTable = true;
+
+	// Whether the solution cache is checked before searching and given the solution after.
+	// The depth limited and iterative deepening searches never use it
+	bool useCache = true;
+
+	// Weight on the heuristic of the A* searches. Above one they expand far fewer nodes and
+	// find a solution at most that many times longer than the shortest. Weights are rounded
+	// down to a multiple of one sixteenth
+	double weight = 1;
+
+	// Whether the A* searches keep improving their first solution, lowering the weight by the
+	// step after each one and reusing the nodes already found, until the solution is known to
+	// be the shortest or the time limit in milliseconds is up. A limit of zero never stops early
+	bool anytime = false;
+	double weightStep = 0.5;
+	double timeLimit = 0;
+};
+
+// Outcome of one search, filled in by the solver and displayed by whoever started it
+struct searchResult
+{
+	// Whether the start state was a packed board of the tiles 0 to 8, each once, with the
+	// blank index pointing at the blank. Other boards are never searched and are reported
+	// as unsolvable too
+	bool valid = true;
+
+	// Whether the start state can reach the goal. States that can't are never searched
+	bool solvable = true;
+
+	// Whether the goal was reached
+	bool solved = false;
+
+	// Whether the solution came from the solution cache instead of a search. The depth and
+	// node count are then those of the search that first solved the state
+	bool cached = false;
+
+	// Depth of the solution, or the depth reached when no solution was found
+	int depth = 0;
+
+	// Number of nodes expanded, or of table lookups for the distance oracle
+	long long nodesExpanded = 0;
+
+	// Time the search took in milliseconds
+	double milliseconds = 0;
+
+	// Factor the solution is known to be within of the shortest, which is one unless the
+	// heuristic was weighted
+	double suboptimality = 1;
+
+	// States from the initial state to the goal
+	std::vector<board> path;
+};
+
+// Memory a solver's searches use, defined with the searches
+struct searchContext;
+
+// Solves start states with any of the searches. A solver is meant for one thread at a time,
+// so each thread that solves boards keeps its own
+class Solver
+{
+public:
+	// Creates a solver whose breadth first and parallel A* searches may use up to the given
+	// number of threads
+	explicit Solver(size_t threadCount = 1);
+	~Solver();
+
+	// Solvers can be moved but not copied, since each owns its memory
+	Solver(Solver&& other) noexcept;
+	Solver& operator=(Solver&& other) noexcept;
+
+	// Solves the start state with the given search and settings and returns the result
+	searchResult solve(board start, searchAlgorithm algorithm, const searchOptions& options = searchOptions());
+
+	// Maps the pattern database into memory, building it on the first run. The searches that
+	// use it (pattern database, IDA* and parallel A*) call this on their own, so it only needs
+	// calling to choose when the work happens
+	static void loadTables();
+
+	// Returns whether an earlier run saved the pattern database, so loading it needs no
+	// building. The solver never writes to the console itself, so callers that want to say
+	// why the first load is slow can check this first
+	static bool tablesSaved();
+
+	// Releases the pattern database, which is loaded again the next time it is needed. No
+	// solver may be searching while it is released
+	static void releaseTables();
+
+	// Empties the solution cache every solver shares and sets how many solutions it keeps
+	// before the least recently used are evicted. A capacity of zero turns it off
+	static void setCacheCapacity(size_t capacity);
+
+	// Adds the solutions saved in a cache file to the solution cache, or writes every cached
+	// solution to one, returning whether the file could be read or written
+	static bool loadCache(const std::string& fileName);
+	static bool saveCache(const std::string& fileName);
+
+private:
+	// Memory used by this solver's searches
+	std::unique_ptr <searchContext> context;
+};
+
+// Function prototypes for the packed board helpers
+board packBoard(const int state[9]);
+std::string boardToString(board state);
+bool isValidBoard(board state);
+bool isSolvable(board state);
+std::string pathMoves(const std::vector<board>& path);
+
+// Function prototypes for scoring many boards at once. Each works out the misplaced tiles
+// or Manhattan distance of every board from scratch, using AVX2 when the processor has it
+void misplacedTileCounts(const board* states, size_t count, int* counts);
+void manhattanDistances(const board* states, size_t count, int* distances);
+
+#endif